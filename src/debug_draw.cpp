@@ -0,0 +1,218 @@
+#include "debug_draw.h"
+
+#if DEBUG_DRAW_ENABLED
+
+#include "shader.h"
+
+#include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+  struct Vertex
+  {
+    glm::vec3 position;
+    glm::vec3 color;
+  };
+
+  // each thread appends to its own buffer. the per-buffer mutex is only ever contended while flush()
+  // is draining that buffer, so appends stay cheap
+  struct ThreadBuffer
+  {
+    std::mutex mutex;
+    std::vector<Vertex> vertices;
+  };
+
+  std::mutex registryMutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+
+  // everything below is only touched on the GL thread
+  std::vector<Vertex> merged;
+  GLuint program = 0;
+  GLuint vao = 0;
+  GLuint vbo = 0;
+  GLint viewProjectionLocation = -1;
+
+  const int SPHERE_SEGMENTS = 32;
+
+  const char *vertexShaderSource = R"(
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+uniform mat4 viewProjection;
+
+out vec3 Color;
+
+void main()
+{
+  gl_Position = viewProjection * vec4(aPos, 1.0);
+  Color = aColor;
+}
+)";
+
+  const char *fragmentShaderSource = R"(
+#version 330 core
+in vec3 Color;
+
+out vec4 FragColor;
+
+void main()
+{
+  FragColor = vec4(Color, 1.0);
+}
+)";
+
+  ThreadBuffer &localBuffer()
+  {
+    // the registry holds a second reference, so whatever a thread appended just before exiting is
+    // still drawn on the next flush
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer)
+    {
+      buffer = std::make_shared<ThreadBuffer>();
+      std::lock_guard<std::mutex> lock(registryMutex);
+      threadBuffers.push_back(buffer);
+    }
+    return *buffer;
+  }
+}
+
+namespace debugDraw
+{
+  bool init()
+  {
+    program = createShaderProgram(vertexShaderSource, fragmentShaderSource, "debug draw");
+    if (program == 0)
+    {
+      return false;
+    }
+    viewProjectionLocation = glGetUniformLocation(program, "viewProjection");
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, position));
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, color));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+
+    return true;
+  }
+
+  void destroy()
+  {
+    glDeleteVertexArrays(1, &vao);
+    glDeleteBuffers(1, &vbo);
+    glDeleteProgram(program);
+    vao = vbo = program = 0;
+  }
+
+  void flush(const glm::mat4 &viewProjection)
+  {
+    // merge every thread's primitives, dropping buffers whose threads have exited once they are drained
+    merged.clear();
+    {
+      std::lock_guard<std::mutex> registryLock(registryMutex);
+      for (size_t i = 0; i < threadBuffers.size();)
+      {
+        ThreadBuffer &buffer = *threadBuffers[i];
+        {
+          std::lock_guard<std::mutex> lock(buffer.mutex);
+          merged.insert(merged.end(), buffer.vertices.begin(), buffer.vertices.end());
+          buffer.vertices.clear();
+        }
+        if (threadBuffers[i].use_count() == 1)
+        {
+          threadBuffers[i] = threadBuffers.back();
+          threadBuffers.pop_back();
+        }
+        else
+        {
+          i++;
+        }
+      }
+    }
+
+    if (merged.empty())
+    {
+      return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, merged.size() * sizeof(Vertex), merged.data(), GL_STREAM_DRAW);
+
+    glUseProgram(program);
+    glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
+    glBindVertexArray(vao);
+    glDrawArrays(GL_LINES, 0, (GLsizei)merged.size());
+    glBindVertexArray(0);
+  }
+
+  void line(const glm::vec3 &from, const glm::vec3 &to, const glm::vec3 &color)
+  {
+    ThreadBuffer &buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.vertices.push_back({from, color});
+    buffer.vertices.push_back({to, color});
+  }
+
+  void box(const glm::vec3 &min, const glm::vec3 &max, const glm::vec3 &color)
+  {
+    glm::vec3 corners[8];
+    for (int i = 0; i < 8; i++)
+    {
+      corners[i] = glm::vec3(i & 1 ? max.x : min.x, i & 2 ? max.y : min.y, i & 4 ? max.z : min.z);
+    }
+
+    // the 12 edges join corners whose indices differ in exactly one bit
+    ThreadBuffer &buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    for (int i = 0; i < 8; i++)
+    {
+      for (int bit = 1; bit < 8; bit <<= 1)
+      {
+        if (!(i & bit))
+        {
+          buffer.vertices.push_back({corners[i], color});
+          buffer.vertices.push_back({corners[i | bit], color});
+        }
+      }
+    }
+  }
+
+  void sphere(const glm::vec3 &center, float radius, const glm::vec3 &color)
+  {
+    // one circle in each of the xy, yz and zx planes
+    ThreadBuffer &buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    for (int axis = 0; axis < 3; axis++)
+    {
+      glm::vec3 previous;
+      for (int i = 0; i <= SPHERE_SEGMENTS; i++)
+      {
+        float angle = 2.0f * 3.14159265f * i / SPHERE_SEGMENTS;
+        glm::vec3 offset(0.0f);
+        offset[axis] = radius * std::cos(angle);
+        offset[(axis + 1) % 3] = radius * std::sin(angle);
+        glm::vec3 point = center + offset;
+        if (i > 0)
+        {
+          buffer.vertices.push_back({previous, color});
+          buffer.vertices.push_back({point, color});
+        }
+        previous = point;
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef DEBUG_DRAW_H
+#define DEBUG_DRAW_H
+
+#include <glm/glm.hpp>
+
+// immediate-mode debug drawing of lines, boxes and spheres from anywhere in the code, including worker
+// threads. primitives are appended to a per-thread buffer, merged once per frame by flush() on the GL
+// thread and drawn with a single call. the whole API compiles to nothing in release (NDEBUG) builds
+// unless DEBUG_DRAW_ENABLED is defined to 1.
+#ifndef DEBUG_DRAW_ENABLED
+#ifdef NDEBUG
+#define DEBUG_DRAW_ENABLED 0
+#else
+#define DEBUG_DRAW_ENABLED 1
+#endif
+#endif
+
+namespace debugDraw
+{
+#if DEBUG_DRAW_ENABLED
+  // GL thread only
+  bool init();
+  void destroy();
+  void flush(const glm::mat4 &viewProjection);
+
+  // any thread
+  void line(const glm::vec3 &from, const glm::vec3 &to, const glm::vec3 &color);
+  void box(const glm::vec3 &min, const glm::vec3 &max, const glm::vec3 &color);
+  void sphere(const glm::vec3 &center, float radius, const glm::vec3 &color);
+#else
+  inline bool init() { return true; }
+  inline void destroy() {}
+  inline void flush(const glm::mat4 &) {}
+
+  inline void line(const glm::vec3 &, const glm::vec3 &, const glm::vec3 &) {}
+  inline void box(const glm::vec3 &, const glm::vec3 &, const glm::vec3 &) {}
+  inline void sphere(const glm::vec3 &, float, const glm::vec3 &) {}
+#endif
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include "gl_caps.h"
+
+#include <glad/glad.h>
+
+#include <cstdio>
+
+GLCapabilities queryGLCapabilities()
+{
+  // GLVersion and the GLAD_GL_VERSION_* flags hold the version glad found in find_coreGL
+  GLCapabilities caps;
+  caps.major = GLVersion.major;
+  caps.minor = GLVersion.minor;
+  caps.multiDrawIndirect = GLAD_GL_VERSION_4_3 != 0;
+  caps.computeShaders = GLAD_GL_VERSION_4_3 != 0;
+  caps.bufferStorage = GLAD_GL_VERSION_4_4 != 0;
+  caps.directStateAccess = GLAD_GL_VERSION_4_5 != 0;
+  return caps;
+}
+
+std::string describeGLCapabilities(const GLCapabilities &caps)
+{
+  std::string features;
+  if (caps.multiDrawIndirect)
+  {
+    features += ", MDI";
+  }
+  if (caps.computeShaders)
+  {
+    features += ", compute";
+  }
+  if (caps.bufferStorage)
+  {
+    features += ", buffer storage";
+  }
+  if (caps.directStateAccess)
+  {
+    features += ", DSA";
+  }
+
+  char version[32];
+  std::snprintf(version, sizeof(version), "GL %d.%d", caps.major, caps.minor);
+  std::string description = version;
+  if (!features.empty())
+  {
+    description += " (" + features.substr(2) + ")";
+  }
+  return description;
+}
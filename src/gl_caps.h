@@ -0,0 +1,24 @@
+#ifndef GL_CAPS_H
+#define GL_CAPS_H
+
+#include <string>
+
+// OpenGL version and fast paths available in the current context. renderers check these flags at
+// startup to pick their backend path instead of assuming the 3.3 baseline
+struct GLCapabilities
+{
+  int major = 0;
+  int minor = 0;
+  bool multiDrawIndirect = false; // 4.3
+  bool computeShaders = false;    // 4.3
+  bool bufferStorage = false;     // 4.4
+  bool directStateAccess = false; // 4.5
+};
+
+// read the capabilities of the current context. must be called after gladLoadGLLoader
+GLCapabilities queryGLCapabilities();
+
+// short human-readable summary, e.g. "GL 4.6 (MDI, compute, buffer storage, DSA)"
+std::string describeGLCapabilities(const GLCapabilities &caps);
+
+#endif
@@ -17,6 +17,12 @@
         --profile="core" --api="gl=4.6" --generator="c" --spec="gl" --extensions=""
     Online:
         https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.6
+
+    Local changes:
+        The generated load_GL_VERSION_1_0 .. load_GL_VERSION_4_6 functions were replaced by the
+        GLAD_GL_NAMES / GLAD_GL_NAME_OFFSETS / GLAD_GL_POINTERS tables and load_GL_versions(),
+        produced by tools/glad_tables.py. Rerun it on a freshly generated glad.c after
+        regenerating glad; do not edit the tables by hand.
 */
 
 #include <stdio.h>
@@ -973,765 +979,1579 @@ PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
 PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
 PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
 PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
-static void load_GL_VERSION_1_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_0) return;
-	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
-	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
-	glad_glHint = (PFNGLHINTPROC)load("glHint");
-	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
-	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
-	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
-	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
-	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
-	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
-	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
-	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
-	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
-	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
-	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
-	glad_glClear = (PFNGLCLEARPROC)load("glClear");
-	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
-	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
-	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
-	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
-	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
-	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
-	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
-	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
-	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
-	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
-	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
-	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
-	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
-	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
-	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
-	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
-	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
-	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
-	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
-	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
-	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
-	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
-	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
-	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
-	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
-	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
-	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
-	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
-	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
-	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
-	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
-	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
-	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
-}
-static void load_GL_VERSION_1_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_1) return;
-	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
-	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
-	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
-	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
-	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
-	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
-	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
-	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
-	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
-	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
-	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
-	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
-	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
-}
-static void load_GL_VERSION_1_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_2) return;
-	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
-	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
-	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
-	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
-}
-static void load_GL_VERSION_1_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_3) return;
-	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
-	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
-	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
-	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
-	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
-	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
-	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
-	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
-	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
-}
-static void load_GL_VERSION_1_4(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_4) return;
-	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
-	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
-	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
-	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
-	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
-	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
-	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
-	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
-	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
-}
-static void load_GL_VERSION_1_5(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_1_5) return;
-	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
-	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
-	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
-	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
-	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
-	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
-	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
-	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
-	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
-	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
-	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
-	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
-	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
-	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
-	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
-	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
-	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
-	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
-	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
-}
-static void load_GL_VERSION_2_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_2_0) return;
-	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
-	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
-	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
-	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
-	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
-	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
-	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
-	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
-	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
-	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
-	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
-	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
-	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
-	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
-	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
-	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
-	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
-	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
-	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
-	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
-	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
-	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
-	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
-	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
-	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
-	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
-	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
-	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
-	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
-	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
-	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
-	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
-	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
-	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
-	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
-	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
-	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
-	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
-	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
-	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
-	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
-	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
-	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
-	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
-	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
-	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
-	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
-	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
-	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
-	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
-	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
-	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
-	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
-	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
-	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
-	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
-	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
-	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
-	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
-	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
-	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
-	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
-	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
-	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
-	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
-	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
-	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
-	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
-	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
-	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
-	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
-	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
-	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
-	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
-	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
-	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
-	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
-	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
-	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
-	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
-	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
-	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
-	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
-	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
-	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
-	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
-	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
-	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
-	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
-	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
-	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
-	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
-	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
-}
-static void load_GL_VERSION_2_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_2_1) return;
-	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
-	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
-	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
-	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
-	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
-	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
-}
-static void load_GL_VERSION_3_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_0) return;
-	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
-	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
-	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
-	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
-	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
-	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
-	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
-	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
-	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
-	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
-	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
-	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
-	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
-	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
-	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
-	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
-	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
-	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
-	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
-	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
-	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
-	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
-	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
-	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
-	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
-	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
-	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
-	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
-	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
-	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
-	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
-	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
-	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
-	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
-	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
-	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
-	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
-	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
-	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
-	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
-	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
-	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
-	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
-	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
-	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
-	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
-	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
-	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
-	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
-	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
-	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
-	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
-	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
-	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
-	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
-	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
-	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
-	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
-	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
-	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
-	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
-	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
-	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
-	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
-	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
-	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
-	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
-	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
-	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
-	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
-	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
-	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
-	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
-	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
-	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
-	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
-	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
-	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
-	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
-	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
-	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
-	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
-	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
-	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
-}
-static void load_GL_VERSION_3_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_1) return;
-	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
-	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
-	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
-	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
-	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
-	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
-	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
-	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
-	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
-	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
-	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
-	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
-	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
-	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
-	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
-}
-static void load_GL_VERSION_3_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_2) return;
-	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
-	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
-	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
-	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
-	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
-	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
-	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
-	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
-	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
-	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
-	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
-	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
-	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
-	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
-	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
-	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
-	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
-	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
-	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
-}
-static void load_GL_VERSION_3_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_3_3) return;
-	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
-	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
-	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
-	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
-	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
-	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
-	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
-	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
-	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
-	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
-	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
-	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
-	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
-	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
-	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
-	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
-	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
-	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
-	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
-	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
-	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
-	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
-	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
-	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
-	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
-	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
-	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
-	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
-	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
-	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
-	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
-	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
-	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
-	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
-	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
-	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
-	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
-	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
-	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
-	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
-	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
-	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
-	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
-	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
-	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
-	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
-	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
-	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
-	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
-	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
-	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
-	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
-	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
-	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
-	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
-	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
-	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
-	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
-}
-static void load_GL_VERSION_4_0(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_0) return;
-	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
-	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
-	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
-	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
-	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
-	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
-	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
-	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
-	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
-	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
-	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
-	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
-	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
-	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
-	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
-	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
-	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
-	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
-	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
-	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
-	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
-	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
-	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
-	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
-	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
-	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
-	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
-	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
-	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
-	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
-	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
-	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
-	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
-	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
-	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
-	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
-	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
-	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
-	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
-	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
-	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
-	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
-	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
-	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
-	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
-	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
-}
-static void load_GL_VERSION_4_1(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_1) return;
-	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
-	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
-	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
-	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
-	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
-	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
-	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
-	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
-	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
-	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
-	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
-	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
-	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
-	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
-	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
-	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
-	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
-	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
-	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
-	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
-	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
-	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
-	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
-	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
-	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
-	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
-	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
-	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
-	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
-	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
-	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
-	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
-	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
-	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
-	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
-	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
-	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
-	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
-	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
-	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
-	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
-	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
-	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
-	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
-	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
-	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
-	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
-	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
-	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
-	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
-	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
-	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
-	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
-	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
-	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
-	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
-	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
-	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
-	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
-	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
-	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
-	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
-	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
-	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
-	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
-	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
-	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
-	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
-	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
-	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)load("glVertexAttribL1d");
-	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)load("glVertexAttribL2d");
-	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)load("glVertexAttribL3d");
-	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)load("glVertexAttribL4d");
-	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)load("glVertexAttribL1dv");
-	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)load("glVertexAttribL2dv");
-	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)load("glVertexAttribL3dv");
-	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)load("glVertexAttribL4dv");
-	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)load("glVertexAttribLPointer");
-	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)load("glGetVertexAttribLdv");
-	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)load("glViewportArrayv");
-	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)load("glViewportIndexedf");
-	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)load("glViewportIndexedfv");
-	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)load("glScissorArrayv");
-	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)load("glScissorIndexed");
-	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)load("glScissorIndexedv");
-	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)load("glDepthRangeArrayv");
-	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)load("glDepthRangeIndexed");
-	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
-	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
-}
-static void load_GL_VERSION_4_2(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_2) return;
-	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
-	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
-	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
-	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
-	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
-	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
-	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
-	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
-	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
-	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
-	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
-	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
-}
-static void load_GL_VERSION_4_3(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_3) return;
-	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
-	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
-	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
-	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
-	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
-	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
-	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
-	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
-	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
-	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
-	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
-	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
-	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
-	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
-	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
-	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
-	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
-	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
-	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
-	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
-	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
-	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
-	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
-	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
-	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
-	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
-	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
-	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
-	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
-	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
-	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
-	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
-	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
-	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
-	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
-	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
-	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
-	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
-	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
-	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
-	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
-	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
-	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
-	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
-}
-static void load_GL_VERSION_4_4(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_4) return;
-	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
-	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
-	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
-	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
-	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
-	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
-	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
-	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
-	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
-}
-static void load_GL_VERSION_4_5(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_5) return;
-	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
-	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
-	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
-	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
-	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
-	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
-	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
-	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
-	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
-	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
-	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
-	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
-	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
-	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
-	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
-	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
-	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
-	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
-	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
-	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
-	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
-	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
-	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
-	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
-	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
-	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
-	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
-	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
-	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
-	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
-	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
-	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
-	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
-	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
-	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
-	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
-	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
-	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
-	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
-	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
-	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
-	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
-	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
-	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
-	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
-	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
-	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
-	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
-	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
-	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
-	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
-	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
-	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
-	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
-	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
-	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
-	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
-	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
-	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
-	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
-	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
-	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
-	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
-	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
-	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
-	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
-	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
-	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
-	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
-	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
-	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
-	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
-	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
-	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
-	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
-	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
-	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
-	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
-	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
-	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
-	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
-	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
-	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
-	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
-	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
-	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
-	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
-	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
-	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
-	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
-	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
-	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
-	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
-	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
-	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
-	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
-	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
-	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
-	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
-	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
-	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
-	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
-	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
-	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
-	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
-	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
-	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
-	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
-	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
-	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)load("glGetnMapdv");
-	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)load("glGetnMapfv");
-	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)load("glGetnMapiv");
-	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)load("glGetnPixelMapfv");
-	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)load("glGetnPixelMapuiv");
-	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)load("glGetnPixelMapusv");
-	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)load("glGetnPolygonStipple");
-	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)load("glGetnColorTable");
-	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)load("glGetnConvolutionFilter");
-	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)load("glGetnSeparableFilter");
-	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)load("glGetnHistogram");
-	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)load("glGetnMinmax");
-	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
-}
-static void load_GL_VERSION_4_6(GLADloadproc load) {
-	if(!GLAD_GL_VERSION_4_6) return;
-	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)load("glSpecializeShader");
-	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)load("glMultiDrawArraysIndirectCount");
-	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
-	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
+/* Core function names and pointers for every GL version, in the order load_GL_versions() resolves them.
+ * GLAD_GL_NAMES is a single blob of NUL-terminated names, GLAD_GL_NAME_OFFSETS indexes into it and
+ * GLAD_GL_POINTERS holds the address of the matching glad_gl* pointer. Each GL version owns a
+ * contiguous range of entries in GLAD_GL_VERSION_RANGES. */
+static const char GLAD_GL_NAMES[] =
+	/* GL_VERSION_1_0 */
+	"glCullFace\0"
+	"glFrontFace\0"
+	"glHint\0"
+	"glLineWidth\0"
+	"glPointSize\0"
+	"glPolygonMode\0"
+	"glScissor\0"
+	"glTexParameterf\0"
+	"glTexParameterfv\0"
+	"glTexParameteri\0"
+	"glTexParameteriv\0"
+	"glTexImage1D\0"
+	"glTexImage2D\0"
+	"glDrawBuffer\0"
+	"glClear\0"
+	"glClearColor\0"
+	"glClearStencil\0"
+	"glClearDepth\0"
+	"glStencilMask\0"
+	"glColorMask\0"
+	"glDepthMask\0"
+	"glDisable\0"
+	"glEnable\0"
+	"glFinish\0"
+	"glFlush\0"
+	"glBlendFunc\0"
+	"glLogicOp\0"
+	"glStencilFunc\0"
+	"glStencilOp\0"
+	"glDepthFunc\0"
+	"glPixelStoref\0"
+	"glPixelStorei\0"
+	"glReadBuffer\0"
+	"glReadPixels\0"
+	"glGetBooleanv\0"
+	"glGetDoublev\0"
+	"glGetError\0"
+	"glGetFloatv\0"
+	"glGetIntegerv\0"
+	"glGetString\0"
+	"glGetTexImage\0"
+	"glGetTexParameterfv\0"
+	"glGetTexParameteriv\0"
+	"glGetTexLevelParameterfv\0"
+	"glGetTexLevelParameteriv\0"
+	"glIsEnabled\0"
+	"glDepthRange\0"
+	"glViewport\0"
+	/* GL_VERSION_1_1 */
+	"glDrawArrays\0"
+	"glDrawElements\0"
+	"glPolygonOffset\0"
+	"glCopyTexImage1D\0"
+	"glCopyTexImage2D\0"
+	"glCopyTexSubImage1D\0"
+	"glCopyTexSubImage2D\0"
+	"glTexSubImage1D\0"
+	"glTexSubImage2D\0"
+	"glBindTexture\0"
+	"glDeleteTextures\0"
+	"glGenTextures\0"
+	"glIsTexture\0"
+	/* GL_VERSION_1_2 */
+	"glDrawRangeElements\0"
+	"glTexImage3D\0"
+	"glTexSubImage3D\0"
+	"glCopyTexSubImage3D\0"
+	/* GL_VERSION_1_3 */
+	"glActiveTexture\0"
+	"glSampleCoverage\0"
+	"glCompressedTexImage3D\0"
+	"glCompressedTexImage2D\0"
+	"glCompressedTexImage1D\0"
+	"glCompressedTexSubImage3D\0"
+	"glCompressedTexSubImage2D\0"
+	"glCompressedTexSubImage1D\0"
+	"glGetCompressedTexImage\0"
+	/* GL_VERSION_1_4 */
+	"glBlendFuncSeparate\0"
+	"glMultiDrawArrays\0"
+	"glMultiDrawElements\0"
+	"glPointParameterf\0"
+	"glPointParameterfv\0"
+	"glPointParameteri\0"
+	"glPointParameteriv\0"
+	"glBlendColor\0"
+	"glBlendEquation\0"
+	/* GL_VERSION_1_5 */
+	"glGenQueries\0"
+	"glDeleteQueries\0"
+	"glIsQuery\0"
+	"glBeginQuery\0"
+	"glEndQuery\0"
+	"glGetQueryiv\0"
+	"glGetQueryObjectiv\0"
+	"glGetQueryObjectuiv\0"
+	"glBindBuffer\0"
+	"glDeleteBuffers\0"
+	"glGenBuffers\0"
+	"glIsBuffer\0"
+	"glBufferData\0"
+	"glBufferSubData\0"
+	"glGetBufferSubData\0"
+	"glMapBuffer\0"
+	"glUnmapBuffer\0"
+	"glGetBufferParameteriv\0"
+	"glGetBufferPointerv\0"
+	/* GL_VERSION_2_0 */
+	"glBlendEquationSeparate\0"
+	"glDrawBuffers\0"
+	"glStencilOpSeparate\0"
+	"glStencilFuncSeparate\0"
+	"glStencilMaskSeparate\0"
+	"glAttachShader\0"
+	"glBindAttribLocation\0"
+	"glCompileShader\0"
+	"glCreateProgram\0"
+	"glCreateShader\0"
+	"glDeleteProgram\0"
+	"glDeleteShader\0"
+	"glDetachShader\0"
+	"glDisableVertexAttribArray\0"
+	"glEnableVertexAttribArray\0"
+	"glGetActiveAttrib\0"
+	"glGetActiveUniform\0"
+	"glGetAttachedShaders\0"
+	"glGetAttribLocation\0"
+	"glGetProgramiv\0"
+	"glGetProgramInfoLog\0"
+	"glGetShaderiv\0"
+	"glGetShaderInfoLog\0"
+	"glGetShaderSource\0"
+	"glGetUniformLocation\0"
+	"glGetUniformfv\0"
+	"glGetUniformiv\0"
+	"glGetVertexAttribdv\0"
+	"glGetVertexAttribfv\0"
+	"glGetVertexAttribiv\0"
+	"glGetVertexAttribPointerv\0"
+	"glIsProgram\0"
+	"glIsShader\0"
+	"glLinkProgram\0"
+	"glShaderSource\0"
+	"glUseProgram\0"
+	"glUniform1f\0"
+	"glUniform2f\0"
+	"glUniform3f\0"
+	"glUniform4f\0"
+	"glUniform1i\0"
+	"glUniform2i\0"
+	"glUniform3i\0"
+	"glUniform4i\0"
+	"glUniform1fv\0"
+	"glUniform2fv\0"
+	"glUniform3fv\0"
+	"glUniform4fv\0"
+	"glUniform1iv\0"
+	"glUniform2iv\0"
+	"glUniform3iv\0"
+	"glUniform4iv\0"
+	"glUniformMatrix2fv\0"
+	"glUniformMatrix3fv\0"
+	"glUniformMatrix4fv\0"
+	"glValidateProgram\0"
+	"glVertexAttrib1d\0"
+	"glVertexAttrib1dv\0"
+	"glVertexAttrib1f\0"
+	"glVertexAttrib1fv\0"
+	"glVertexAttrib1s\0"
+	"glVertexAttrib1sv\0"
+	"glVertexAttrib2d\0"
+	"glVertexAttrib2dv\0"
+	"glVertexAttrib2f\0"
+	"glVertexAttrib2fv\0"
+	"glVertexAttrib2s\0"
+	"glVertexAttrib2sv\0"
+	"glVertexAttrib3d\0"
+	"glVertexAttrib3dv\0"
+	"glVertexAttrib3f\0"
+	"glVertexAttrib3fv\0"
+	"glVertexAttrib3s\0"
+	"glVertexAttrib3sv\0"
+	"glVertexAttrib4Nbv\0"
+	"glVertexAttrib4Niv\0"
+	"glVertexAttrib4Nsv\0"
+	"glVertexAttrib4Nub\0"
+	"glVertexAttrib4Nubv\0"
+	"glVertexAttrib4Nuiv\0"
+	"glVertexAttrib4Nusv\0"
+	"glVertexAttrib4bv\0"
+	"glVertexAttrib4d\0"
+	"glVertexAttrib4dv\0"
+	"glVertexAttrib4f\0"
+	"glVertexAttrib4fv\0"
+	"glVertexAttrib4iv\0"
+	"glVertexAttrib4s\0"
+	"glVertexAttrib4sv\0"
+	"glVertexAttrib4ubv\0"
+	"glVertexAttrib4uiv\0"
+	"glVertexAttrib4usv\0"
+	"glVertexAttribPointer\0"
+	/* GL_VERSION_2_1 */
+	"glUniformMatrix2x3fv\0"
+	"glUniformMatrix3x2fv\0"
+	"glUniformMatrix2x4fv\0"
+	"glUniformMatrix4x2fv\0"
+	"glUniformMatrix3x4fv\0"
+	"glUniformMatrix4x3fv\0"
+	/* GL_VERSION_3_0 */
+	"glColorMaski\0"
+	"glGetBooleani_v\0"
+	"glGetIntegeri_v\0"
+	"glEnablei\0"
+	"glDisablei\0"
+	"glIsEnabledi\0"
+	"glBeginTransformFeedback\0"
+	"glEndTransformFeedback\0"
+	"glBindBufferRange\0"
+	"glBindBufferBase\0"
+	"glTransformFeedbackVaryings\0"
+	"glGetTransformFeedbackVarying\0"
+	"glClampColor\0"
+	"glBeginConditionalRender\0"
+	"glEndConditionalRender\0"
+	"glVertexAttribIPointer\0"
+	"glGetVertexAttribIiv\0"
+	"glGetVertexAttribIuiv\0"
+	"glVertexAttribI1i\0"
+	"glVertexAttribI2i\0"
+	"glVertexAttribI3i\0"
+	"glVertexAttribI4i\0"
+	"glVertexAttribI1ui\0"
+	"glVertexAttribI2ui\0"
+	"glVertexAttribI3ui\0"
+	"glVertexAttribI4ui\0"
+	"glVertexAttribI1iv\0"
+	"glVertexAttribI2iv\0"
+	"glVertexAttribI3iv\0"
+	"glVertexAttribI4iv\0"
+	"glVertexAttribI1uiv\0"
+	"glVertexAttribI2uiv\0"
+	"glVertexAttribI3uiv\0"
+	"glVertexAttribI4uiv\0"
+	"glVertexAttribI4bv\0"
+	"glVertexAttribI4sv\0"
+	"glVertexAttribI4ubv\0"
+	"glVertexAttribI4usv\0"
+	"glGetUniformuiv\0"
+	"glBindFragDataLocation\0"
+	"glGetFragDataLocation\0"
+	"glUniform1ui\0"
+	"glUniform2ui\0"
+	"glUniform3ui\0"
+	"glUniform4ui\0"
+	"glUniform1uiv\0"
+	"glUniform2uiv\0"
+	"glUniform3uiv\0"
+	"glUniform4uiv\0"
+	"glTexParameterIiv\0"
+	"glTexParameterIuiv\0"
+	"glGetTexParameterIiv\0"
+	"glGetTexParameterIuiv\0"
+	"glClearBufferiv\0"
+	"glClearBufferuiv\0"
+	"glClearBufferfv\0"
+	"glClearBufferfi\0"
+	"glGetStringi\0"
+	"glIsRenderbuffer\0"
+	"glBindRenderbuffer\0"
+	"glDeleteRenderbuffers\0"
+	"glGenRenderbuffers\0"
+	"glRenderbufferStorage\0"
+	"glGetRenderbufferParameteriv\0"
+	"glIsFramebuffer\0"
+	"glBindFramebuffer\0"
+	"glDeleteFramebuffers\0"
+	"glGenFramebuffers\0"
+	"glCheckFramebufferStatus\0"
+	"glFramebufferTexture1D\0"
+	"glFramebufferTexture2D\0"
+	"glFramebufferTexture3D\0"
+	"glFramebufferRenderbuffer\0"
+	"glGetFramebufferAttachmentParameteriv\0"
+	"glGenerateMipmap\0"
+	"glBlitFramebuffer\0"
+	"glRenderbufferStorageMultisample\0"
+	"glFramebufferTextureLayer\0"
+	"glMapBufferRange\0"
+	"glFlushMappedBufferRange\0"
+	"glBindVertexArray\0"
+	"glDeleteVertexArrays\0"
+	"glGenVertexArrays\0"
+	"glIsVertexArray\0"
+	/* GL_VERSION_3_1 */
+	"glDrawArraysInstanced\0"
+	"glDrawElementsInstanced\0"
+	"glTexBuffer\0"
+	"glPrimitiveRestartIndex\0"
+	"glCopyBufferSubData\0"
+	"glGetUniformIndices\0"
+	"glGetActiveUniformsiv\0"
+	"glGetActiveUniformName\0"
+	"glGetUniformBlockIndex\0"
+	"glGetActiveUniformBlockiv\0"
+	"glGetActiveUniformBlockName\0"
+	"glUniformBlockBinding\0"
+	"glBindBufferRange\0"
+	"glBindBufferBase\0"
+	"glGetIntegeri_v\0"
+	/* GL_VERSION_3_2 */
+	"glDrawElementsBaseVertex\0"
+	"glDrawRangeElementsBaseVertex\0"
+	"glDrawElementsInstancedBaseVertex\0"
+	"glMultiDrawElementsBaseVertex\0"
+	"glProvokingVertex\0"
+	"glFenceSync\0"
+	"glIsSync\0"
+	"glDeleteSync\0"
+	"glClientWaitSync\0"
+	"glWaitSync\0"
+	"glGetInteger64v\0"
+	"glGetSynciv\0"
+	"glGetInteger64i_v\0"
+	"glGetBufferParameteri64v\0"
+	"glFramebufferTexture\0"
+	"glTexImage2DMultisample\0"
+	"glTexImage3DMultisample\0"
+	"glGetMultisamplefv\0"
+	"glSampleMaski\0"
+	/* GL_VERSION_3_3 */
+	"glBindFragDataLocationIndexed\0"
+	"glGetFragDataIndex\0"
+	"glGenSamplers\0"
+	"glDeleteSamplers\0"
+	"glIsSampler\0"
+	"glBindSampler\0"
+	"glSamplerParameteri\0"
+	"glSamplerParameteriv\0"
+	"glSamplerParameterf\0"
+	"glSamplerParameterfv\0"
+	"glSamplerParameterIiv\0"
+	"glSamplerParameterIuiv\0"
+	"glGetSamplerParameteriv\0"
+	"glGetSamplerParameterIiv\0"
+	"glGetSamplerParameterfv\0"
+	"glGetSamplerParameterIuiv\0"
+	"glQueryCounter\0"
+	"glGetQueryObjecti64v\0"
+	"glGetQueryObjectui64v\0"
+	"glVertexAttribDivisor\0"
+	"glVertexAttribP1ui\0"
+	"glVertexAttribP1uiv\0"
+	"glVertexAttribP2ui\0"
+	"glVertexAttribP2uiv\0"
+	"glVertexAttribP3ui\0"
+	"glVertexAttribP3uiv\0"
+	"glVertexAttribP4ui\0"
+	"glVertexAttribP4uiv\0"
+	"glVertexP2ui\0"
+	"glVertexP2uiv\0"
+	"glVertexP3ui\0"
+	"glVertexP3uiv\0"
+	"glVertexP4ui\0"
+	"glVertexP4uiv\0"
+	"glTexCoordP1ui\0"
+	"glTexCoordP1uiv\0"
+	"glTexCoordP2ui\0"
+	"glTexCoordP2uiv\0"
+	"glTexCoordP3ui\0"
+	"glTexCoordP3uiv\0"
+	"glTexCoordP4ui\0"
+	"glTexCoordP4uiv\0"
+	"glMultiTexCoordP1ui\0"
+	"glMultiTexCoordP1uiv\0"
+	"glMultiTexCoordP2ui\0"
+	"glMultiTexCoordP2uiv\0"
+	"glMultiTexCoordP3ui\0"
+	"glMultiTexCoordP3uiv\0"
+	"glMultiTexCoordP4ui\0"
+	"glMultiTexCoordP4uiv\0"
+	"glNormalP3ui\0"
+	"glNormalP3uiv\0"
+	"glColorP3ui\0"
+	"glColorP3uiv\0"
+	"glColorP4ui\0"
+	"glColorP4uiv\0"
+	"glSecondaryColorP3ui\0"
+	"glSecondaryColorP3uiv\0"
+	/* GL_VERSION_4_0 */
+	"glMinSampleShading\0"
+	"glBlendEquationi\0"
+	"glBlendEquationSeparatei\0"
+	"glBlendFunci\0"
+	"glBlendFuncSeparatei\0"
+	"glDrawArraysIndirect\0"
+	"glDrawElementsIndirect\0"
+	"glUniform1d\0"
+	"glUniform2d\0"
+	"glUniform3d\0"
+	"glUniform4d\0"
+	"glUniform1dv\0"
+	"glUniform2dv\0"
+	"glUniform3dv\0"
+	"glUniform4dv\0"
+	"glUniformMatrix2dv\0"
+	"glUniformMatrix3dv\0"
+	"glUniformMatrix4dv\0"
+	"glUniformMatrix2x3dv\0"
+	"glUniformMatrix2x4dv\0"
+	"glUniformMatrix3x2dv\0"
+	"glUniformMatrix3x4dv\0"
+	"glUniformMatrix4x2dv\0"
+	"glUniformMatrix4x3dv\0"
+	"glGetUniformdv\0"
+	"glGetSubroutineUniformLocation\0"
+	"glGetSubroutineIndex\0"
+	"glGetActiveSubroutineUniformiv\0"
+	"glGetActiveSubroutineUniformName\0"
+	"glGetActiveSubroutineName\0"
+	"glUniformSubroutinesuiv\0"
+	"glGetUniformSubroutineuiv\0"
+	"glGetProgramStageiv\0"
+	"glPatchParameteri\0"
+	"glPatchParameterfv\0"
+	"glBindTransformFeedback\0"
+	"glDeleteTransformFeedbacks\0"
+	"glGenTransformFeedbacks\0"
+	"glIsTransformFeedback\0"
+	"glPauseTransformFeedback\0"
+	"glResumeTransformFeedback\0"
+	"glDrawTransformFeedback\0"
+	"glDrawTransformFeedbackStream\0"
+	"glBeginQueryIndexed\0"
+	"glEndQueryIndexed\0"
+	"glGetQueryIndexediv\0"
+	/* GL_VERSION_4_1 */
+	"glReleaseShaderCompiler\0"
+	"glShaderBinary\0"
+	"glGetShaderPrecisionFormat\0"
+	"glDepthRangef\0"
+	"glClearDepthf\0"
+	"glGetProgramBinary\0"
+	"glProgramBinary\0"
+	"glProgramParameteri\0"
+	"glUseProgramStages\0"
+	"glActiveShaderProgram\0"
+	"glCreateShaderProgramv\0"
+	"glBindProgramPipeline\0"
+	"glDeleteProgramPipelines\0"
+	"glGenProgramPipelines\0"
+	"glIsProgramPipeline\0"
+	"glGetProgramPipelineiv\0"
+	"glProgramParameteri\0"
+	"glProgramUniform1i\0"
+	"glProgramUniform1iv\0"
+	"glProgramUniform1f\0"
+	"glProgramUniform1fv\0"
+	"glProgramUniform1d\0"
+	"glProgramUniform1dv\0"
+	"glProgramUniform1ui\0"
+	"glProgramUniform1uiv\0"
+	"glProgramUniform2i\0"
+	"glProgramUniform2iv\0"
+	"glProgramUniform2f\0"
+	"glProgramUniform2fv\0"
+	"glProgramUniform2d\0"
+	"glProgramUniform2dv\0"
+	"glProgramUniform2ui\0"
+	"glProgramUniform2uiv\0"
+	"glProgramUniform3i\0"
+	"glProgramUniform3iv\0"
+	"glProgramUniform3f\0"
+	"glProgramUniform3fv\0"
+	"glProgramUniform3d\0"
+	"glProgramUniform3dv\0"
+	"glProgramUniform3ui\0"
+	"glProgramUniform3uiv\0"
+	"glProgramUniform4i\0"
+	"glProgramUniform4iv\0"
+	"glProgramUniform4f\0"
+	"glProgramUniform4fv\0"
+	"glProgramUniform4d\0"
+	"glProgramUniform4dv\0"
+	"glProgramUniform4ui\0"
+	"glProgramUniform4uiv\0"
+	"glProgramUniformMatrix2fv\0"
+	"glProgramUniformMatrix3fv\0"
+	"glProgramUniformMatrix4fv\0"
+	"glProgramUniformMatrix2dv\0"
+	"glProgramUniformMatrix3dv\0"
+	"glProgramUniformMatrix4dv\0"
+	"glProgramUniformMatrix2x3fv\0"
+	"glProgramUniformMatrix3x2fv\0"
+	"glProgramUniformMatrix2x4fv\0"
+	"glProgramUniformMatrix4x2fv\0"
+	"glProgramUniformMatrix3x4fv\0"
+	"glProgramUniformMatrix4x3fv\0"
+	"glProgramUniformMatrix2x3dv\0"
+	"glProgramUniformMatrix3x2dv\0"
+	"glProgramUniformMatrix2x4dv\0"
+	"glProgramUniformMatrix4x2dv\0"
+	"glProgramUniformMatrix3x4dv\0"
+	"glProgramUniformMatrix4x3dv\0"
+	"glValidateProgramPipeline\0"
+	"glGetProgramPipelineInfoLog\0"
+	"glVertexAttribL1d\0"
+	"glVertexAttribL2d\0"
+	"glVertexAttribL3d\0"
+	"glVertexAttribL4d\0"
+	"glVertexAttribL1dv\0"
+	"glVertexAttribL2dv\0"
+	"glVertexAttribL3dv\0"
+	"glVertexAttribL4dv\0"
+	"glVertexAttribLPointer\0"
+	"glGetVertexAttribLdv\0"
+	"glViewportArrayv\0"
+	"glViewportIndexedf\0"
+	"glViewportIndexedfv\0"
+	"glScissorArrayv\0"
+	"glScissorIndexed\0"
+	"glScissorIndexedv\0"
+	"glDepthRangeArrayv\0"
+	"glDepthRangeIndexed\0"
+	"glGetFloati_v\0"
+	"glGetDoublei_v\0"
+	/* GL_VERSION_4_2 */
+	"glDrawArraysInstancedBaseInstance\0"
+	"glDrawElementsInstancedBaseInstance\0"
+	"glDrawElementsInstancedBaseVertexBaseInstance\0"
+	"glGetInternalformativ\0"
+	"glGetActiveAtomicCounterBufferiv\0"
+	"glBindImageTexture\0"
+	"glMemoryBarrier\0"
+	"glTexStorage1D\0"
+	"glTexStorage2D\0"
+	"glTexStorage3D\0"
+	"glDrawTransformFeedbackInstanced\0"
+	"glDrawTransformFeedbackStreamInstanced\0"
+	/* GL_VERSION_4_3 */
+	"glClearBufferData\0"
+	"glClearBufferSubData\0"
+	"glDispatchCompute\0"
+	"glDispatchComputeIndirect\0"
+	"glCopyImageSubData\0"
+	"glFramebufferParameteri\0"
+	"glGetFramebufferParameteriv\0"
+	"glGetInternalformati64v\0"
+	"glInvalidateTexSubImage\0"
+	"glInvalidateTexImage\0"
+	"glInvalidateBufferSubData\0"
+	"glInvalidateBufferData\0"
+	"glInvalidateFramebuffer\0"
+	"glInvalidateSubFramebuffer\0"
+	"glMultiDrawArraysIndirect\0"
+	"glMultiDrawElementsIndirect\0"
+	"glGetProgramInterfaceiv\0"
+	"glGetProgramResourceIndex\0"
+	"glGetProgramResourceName\0"
+	"glGetProgramResourceiv\0"
+	"glGetProgramResourceLocation\0"
+	"glGetProgramResourceLocationIndex\0"
+	"glShaderStorageBlockBinding\0"
+	"glTexBufferRange\0"
+	"glTexStorage2DMultisample\0"
+	"glTexStorage3DMultisample\0"
+	"glTextureView\0"
+	"glBindVertexBuffer\0"
+	"glVertexAttribFormat\0"
+	"glVertexAttribIFormat\0"
+	"glVertexAttribLFormat\0"
+	"glVertexAttribBinding\0"
+	"glVertexBindingDivisor\0"
+	"glDebugMessageControl\0"
+	"glDebugMessageInsert\0"
+	"glDebugMessageCallback\0"
+	"glGetDebugMessageLog\0"
+	"glPushDebugGroup\0"
+	"glPopDebugGroup\0"
+	"glObjectLabel\0"
+	"glGetObjectLabel\0"
+	"glObjectPtrLabel\0"
+	"glGetObjectPtrLabel\0"
+	"glGetPointerv\0"
+	/* GL_VERSION_4_4 */
+	"glBufferStorage\0"
+	"glClearTexImage\0"
+	"glClearTexSubImage\0"
+	"glBindBuffersBase\0"
+	"glBindBuffersRange\0"
+	"glBindTextures\0"
+	"glBindSamplers\0"
+	"glBindImageTextures\0"
+	"glBindVertexBuffers\0"
+	/* GL_VERSION_4_5 */
+	"glClipControl\0"
+	"glCreateTransformFeedbacks\0"
+	"glTransformFeedbackBufferBase\0"
+	"glTransformFeedbackBufferRange\0"
+	"glGetTransformFeedbackiv\0"
+	"glGetTransformFeedbacki_v\0"
+	"glGetTransformFeedbacki64_v\0"
+	"glCreateBuffers\0"
+	"glNamedBufferStorage\0"
+	"glNamedBufferData\0"
+	"glNamedBufferSubData\0"
+	"glCopyNamedBufferSubData\0"
+	"glClearNamedBufferData\0"
+	"glClearNamedBufferSubData\0"
+	"glMapNamedBuffer\0"
+	"glMapNamedBufferRange\0"
+	"glUnmapNamedBuffer\0"
+	"glFlushMappedNamedBufferRange\0"
+	"glGetNamedBufferParameteriv\0"
+	"glGetNamedBufferParameteri64v\0"
+	"glGetNamedBufferPointerv\0"
+	"glGetNamedBufferSubData\0"
+	"glCreateFramebuffers\0"
+	"glNamedFramebufferRenderbuffer\0"
+	"glNamedFramebufferParameteri\0"
+	"glNamedFramebufferTexture\0"
+	"glNamedFramebufferTextureLayer\0"
+	"glNamedFramebufferDrawBuffer\0"
+	"glNamedFramebufferDrawBuffers\0"
+	"glNamedFramebufferReadBuffer\0"
+	"glInvalidateNamedFramebufferData\0"
+	"glInvalidateNamedFramebufferSubData\0"
+	"glClearNamedFramebufferiv\0"
+	"glClearNamedFramebufferuiv\0"
+	"glClearNamedFramebufferfv\0"
+	"glClearNamedFramebufferfi\0"
+	"glBlitNamedFramebuffer\0"
+	"glCheckNamedFramebufferStatus\0"
+	"glGetNamedFramebufferParameteriv\0"
+	"glGetNamedFramebufferAttachmentParameteriv\0"
+	"glCreateRenderbuffers\0"
+	"glNamedRenderbufferStorage\0"
+	"glNamedRenderbufferStorageMultisample\0"
+	"glGetNamedRenderbufferParameteriv\0"
+	"glCreateTextures\0"
+	"glTextureBuffer\0"
+	"glTextureBufferRange\0"
+	"glTextureStorage1D\0"
+	"glTextureStorage2D\0"
+	"glTextureStorage3D\0"
+	"glTextureStorage2DMultisample\0"
+	"glTextureStorage3DMultisample\0"
+	"glTextureSubImage1D\0"
+	"glTextureSubImage2D\0"
+	"glTextureSubImage3D\0"
+	"glCompressedTextureSubImage1D\0"
+	"glCompressedTextureSubImage2D\0"
+	"glCompressedTextureSubImage3D\0"
+	"glCopyTextureSubImage1D\0"
+	"glCopyTextureSubImage2D\0"
+	"glCopyTextureSubImage3D\0"
+	"glTextureParameterf\0"
+	"glTextureParameterfv\0"
+	"glTextureParameteri\0"
+	"glTextureParameterIiv\0"
+	"glTextureParameterIuiv\0"
+	"glTextureParameteriv\0"
+	"glGenerateTextureMipmap\0"
+	"glBindTextureUnit\0"
+	"glGetTextureImage\0"
+	"glGetCompressedTextureImage\0"
+	"glGetTextureLevelParameterfv\0"
+	"glGetTextureLevelParameteriv\0"
+	"glGetTextureParameterfv\0"
+	"glGetTextureParameterIiv\0"
+	"glGetTextureParameterIuiv\0"
+	"glGetTextureParameteriv\0"
+	"glCreateVertexArrays\0"
+	"glDisableVertexArrayAttrib\0"
+	"glEnableVertexArrayAttrib\0"
+	"glVertexArrayElementBuffer\0"
+	"glVertexArrayVertexBuffer\0"
+	"glVertexArrayVertexBuffers\0"
+	"glVertexArrayAttribBinding\0"
+	"glVertexArrayAttribFormat\0"
+	"glVertexArrayAttribIFormat\0"
+	"glVertexArrayAttribLFormat\0"
+	"glVertexArrayBindingDivisor\0"
+	"glGetVertexArrayiv\0"
+	"glGetVertexArrayIndexediv\0"
+	"glGetVertexArrayIndexed64iv\0"
+	"glCreateSamplers\0"
+	"glCreateProgramPipelines\0"
+	"glCreateQueries\0"
+	"glGetQueryBufferObjecti64v\0"
+	"glGetQueryBufferObjectiv\0"
+	"glGetQueryBufferObjectui64v\0"
+	"glGetQueryBufferObjectuiv\0"
+	"glMemoryBarrierByRegion\0"
+	"glGetTextureSubImage\0"
+	"glGetCompressedTextureSubImage\0"
+	"glGetGraphicsResetStatus\0"
+	"glGetnCompressedTexImage\0"
+	"glGetnTexImage\0"
+	"glGetnUniformdv\0"
+	"glGetnUniformfv\0"
+	"glGetnUniformiv\0"
+	"glGetnUniformuiv\0"
+	"glReadnPixels\0"
+	"glGetnMapdv\0"
+	"glGetnMapfv\0"
+	"glGetnMapiv\0"
+	"glGetnPixelMapfv\0"
+	"glGetnPixelMapuiv\0"
+	"glGetnPixelMapusv\0"
+	"glGetnPolygonStipple\0"
+	"glGetnColorTable\0"
+	"glGetnConvolutionFilter\0"
+	"glGetnSeparableFilter\0"
+	"glGetnHistogram\0"
+	"glGetnMinmax\0"
+	"glTextureBarrier\0"
+	/* GL_VERSION_4_6 */
+	"glSpecializeShader\0"
+	"glMultiDrawArraysIndirectCount\0"
+	"glMultiDrawElementsIndirectCount\0"
+	"glPolygonOffsetClamp\0";
+
+static const unsigned short GLAD_GL_NAME_OFFSETS[] = {
+	/* GL_VERSION_1_0 */
+	0, 11, 23, 30, 42, 54, 68, 78, 94, 111, 127, 144,
+	157, 170, 183, 191, 204, 219, 232, 246, 258, 270, 280, 289,
+	298, 306, 318, 328, 342, 354, 366, 380, 394, 407, 420, 434,
+	447, 458, 470, 484, 496, 510, 530, 550, 575, 600, 612, 625,
+	/* GL_VERSION_1_1 */
+	636, 649, 664, 680, 697, 714, 734, 754, 770, 786, 800, 817,
+	831,
+	/* GL_VERSION_1_2 */
+	843, 863, 876, 892,
+	/* GL_VERSION_1_3 */
+	912, 928, 945, 968, 991, 1014, 1040, 1066, 1092,
+	/* GL_VERSION_1_4 */
+	1116, 1136, 1154, 1174, 1192, 1211, 1229, 1248, 1261,
+	/* GL_VERSION_1_5 */
+	1277, 1290, 1306, 1316, 1329, 1340, 1353, 1372, 1392, 1405, 1421, 1434,
+	1445, 1458, 1474, 1493, 1505, 1519, 1542,
+	/* GL_VERSION_2_0 */
+	1562, 1586, 1600, 1620, 1642, 1664, 1679, 1700, 1716, 1732, 1747, 1763,
+	1778, 1793, 1820, 1846, 1864, 1883, 1904, 1924, 1939, 1959, 1973, 1992,
+	2010, 2031, 2046, 2061, 2081, 2101, 2121, 2147, 2159, 2170, 2184, 2199,
+	2212, 2224, 2236, 2248, 2260, 2272, 2284, 2296, 2308, 2321, 2334, 2347,
+	2360, 2373, 2386, 2399, 2412, 2431, 2450, 2469, 2487, 2504, 2522, 2539,
+	2557, 2574, 2592, 2609, 2627, 2644, 2662, 2679, 2697, 2714, 2732, 2749,
+	2767, 2784, 2802, 2821, 2840, 2859, 2878, 2898, 2918, 2938, 2956, 2973,
+	2991, 3008, 3026, 3044, 3061, 3079, 3098, 3117, 3136,
+	/* GL_VERSION_2_1 */
+	3158, 3179, 3200, 3221, 3242, 3263,
+	/* GL_VERSION_3_0 */
+	3284, 3297, 3313, 3329, 3339, 3350, 3363, 3388, 3411, 3429, 3446, 3474,
+	3504, 3517, 3542, 3565, 3588, 3609, 3631, 3649, 3667, 3685, 3703, 3722,
+	3741, 3760, 3779, 3798, 3817, 3836, 3855, 3875, 3895, 3915, 3935, 3954,
+	3973, 3993, 4013, 4029, 4052, 4074, 4087, 4100, 4113, 4126, 4140, 4154,
+	4168, 4182, 4200, 4219, 4240, 4262, 4278, 4295, 4311, 4327, 4340, 4357,
+	4376, 4398, 4417, 4439, 4468, 4484, 4502, 4523, 4541, 4566, 4589, 4612,
+	4635, 4661, 4699, 4716, 4734, 4767, 4793, 4810, 4835, 4853, 4874, 4892,
+	/* GL_VERSION_3_1 */
+	4908, 4930, 4954, 4966, 4990, 5010, 5030, 5052, 5075, 5098, 5124, 5152,
+	5174, 5192, 5209,
+	/* GL_VERSION_3_2 */
+	5225, 5250, 5280, 5314, 5344, 5362, 5374, 5383, 5396, 5413, 5424, 5440,
+	5452, 5470, 5495, 5516, 5540, 5564, 5583,
+	/* GL_VERSION_3_3 */
+	5597, 5627, 5646, 5660, 5677, 5689, 5703, 5723, 5744, 5764, 5785, 5807,
+	5830, 5854, 5879, 5903, 5929, 5944, 5965, 5987, 6009, 6028, 6048, 6067,
+	6087, 6106, 6126, 6145, 6165, 6178, 6192, 6205, 6219, 6232, 6246, 6261,
+	6277, 6292, 6308, 6323, 6339, 6354, 6370, 6390, 6411, 6431, 6452, 6472,
+	6493, 6513, 6534, 6547, 6561, 6573, 6586, 6598, 6611, 6632,
+	/* GL_VERSION_4_0 */
+	6654, 6673, 6690, 6715, 6728, 6749, 6770, 6793, 6805, 6817, 6829, 6841,
+	6854, 6867, 6880, 6893, 6912, 6931, 6950, 6971, 6992, 7013, 7034, 7055,
+	7076, 7091, 7122, 7143, 7174, 7207, 7233, 7257, 7283, 7303, 7321, 7340,
+	7364, 7391, 7415, 7437, 7462, 7488, 7512, 7542, 7562, 7580,
+	/* GL_VERSION_4_1 */
+	7600, 7624, 7639, 7666, 7680, 7694, 7713, 7729, 7749, 7768, 7790, 7813,
+	7835, 7860, 7882, 7902, 7925, 7945, 7964, 7984, 8003, 8023, 8042, 8062,
+	8082, 8103, 8122, 8142, 8161, 8181, 8200, 8220, 8240, 8261, 8280, 8300,
+	8319, 8339, 8358, 8378, 8398, 8419, 8438, 8458, 8477, 8497, 8516, 8536,
+	8556, 8577, 8603, 8629, 8655, 8681, 8707, 8733, 8761, 8789, 8817, 8845,
+	8873, 8901, 8929, 8957, 8985, 9013, 9041, 9069, 9095, 9123, 9141, 9159,
+	9177, 9195, 9214, 9233, 9252, 9271, 9294, 9315, 9332, 9351, 9371, 9387,
+	9404, 9422, 9441, 9461, 9475,
+	/* GL_VERSION_4_2 */
+	9490, 9524, 9560, 9606, 9628, 9661, 9680, 9696, 9711, 9726, 9741, 9774,
+	/* GL_VERSION_4_3 */
+	9813, 9831, 9852, 9870, 9896, 9915, 9939, 9967, 9991, 10015, 10036, 10062,
+	10085, 10109, 10136, 10162, 10190, 10214, 10240, 10265, 10288, 10317, 10351, 10379,
+	10396, 10422, 10448, 10462, 10481, 10502, 10524, 10546, 10568, 10591, 10613, 10634,
+	10657, 10678, 10695, 10711, 10725, 10742, 10759, 10779,
+	/* GL_VERSION_4_4 */
+	10793, 10809, 10825, 10844, 10862, 10881, 10896, 10911, 10931,
+	/* GL_VERSION_4_5 */
+	10951, 10965, 10992, 11022, 11053, 11078, 11104, 11132, 11148, 11169, 11187, 11208,
+	11233, 11256, 11282, 11299, 11321, 11340, 11370, 11398, 11428, 11453, 11477, 11498,
+	11529, 11558, 11584, 11615, 11644, 11674, 11703, 11736, 11772, 11798, 11825, 11851,
+	11877, 11900, 11930, 11963, 12006, 12028, 12055, 12093, 12127, 12144, 12160, 12181,
+	12200, 12219, 12238, 12268, 12298, 12318, 12338, 12358, 12388, 12418, 12448, 12472,
+	12496, 12520, 12540, 12561, 12581, 12603, 12626, 12647, 12671, 12689, 12707, 12735,
+	12764, 12793, 12817, 12842, 12868, 12892, 12913, 12940, 12966, 12993, 13019, 13046,
+	13073, 13099, 13126, 13153, 13181, 13200, 13226, 13254, 13271, 13296, 13312, 13339,
+	13364, 13392, 13418, 13442, 13463, 13494, 13519, 13544, 13559, 13575, 13591, 13607,
+	13624, 13638, 13650, 13662, 13674, 13691, 13709, 13727, 13748, 13765, 13789, 13811,
+	13827, 13840,
+	/* GL_VERSION_4_6 */
+	13857, 13876, 13907, 13940,
+};
+
+static void *const GLAD_GL_POINTERS[] = {
+	/* GL_VERSION_1_0 */
+	&glad_glCullFace,
+	&glad_glFrontFace,
+	&glad_glHint,
+	&glad_glLineWidth,
+	&glad_glPointSize,
+	&glad_glPolygonMode,
+	&glad_glScissor,
+	&glad_glTexParameterf,
+	&glad_glTexParameterfv,
+	&glad_glTexParameteri,
+	&glad_glTexParameteriv,
+	&glad_glTexImage1D,
+	&glad_glTexImage2D,
+	&glad_glDrawBuffer,
+	&glad_glClear,
+	&glad_glClearColor,
+	&glad_glClearStencil,
+	&glad_glClearDepth,
+	&glad_glStencilMask,
+	&glad_glColorMask,
+	&glad_glDepthMask,
+	&glad_glDisable,
+	&glad_glEnable,
+	&glad_glFinish,
+	&glad_glFlush,
+	&glad_glBlendFunc,
+	&glad_glLogicOp,
+	&glad_glStencilFunc,
+	&glad_glStencilOp,
+	&glad_glDepthFunc,
+	&glad_glPixelStoref,
+	&glad_glPixelStorei,
+	&glad_glReadBuffer,
+	&glad_glReadPixels,
+	&glad_glGetBooleanv,
+	&glad_glGetDoublev,
+	&glad_glGetError,
+	&glad_glGetFloatv,
+	&glad_glGetIntegerv,
+	&glad_glGetString,
+	&glad_glGetTexImage,
+	&glad_glGetTexParameterfv,
+	&glad_glGetTexParameteriv,
+	&glad_glGetTexLevelParameterfv,
+	&glad_glGetTexLevelParameteriv,
+	&glad_glIsEnabled,
+	&glad_glDepthRange,
+	&glad_glViewport,
+	/* GL_VERSION_1_1 */
+	&glad_glDrawArrays,
+	&glad_glDrawElements,
+	&glad_glPolygonOffset,
+	&glad_glCopyTexImage1D,
+	&glad_glCopyTexImage2D,
+	&glad_glCopyTexSubImage1D,
+	&glad_glCopyTexSubImage2D,
+	&glad_glTexSubImage1D,
+	&glad_glTexSubImage2D,
+	&glad_glBindTexture,
+	&glad_glDeleteTextures,
+	&glad_glGenTextures,
+	&glad_glIsTexture,
+	/* GL_VERSION_1_2 */
+	&glad_glDrawRangeElements,
+	&glad_glTexImage3D,
+	&glad_glTexSubImage3D,
+	&glad_glCopyTexSubImage3D,
+	/* GL_VERSION_1_3 */
+	&glad_glActiveTexture,
+	&glad_glSampleCoverage,
+	&glad_glCompressedTexImage3D,
+	&glad_glCompressedTexImage2D,
+	&glad_glCompressedTexImage1D,
+	&glad_glCompressedTexSubImage3D,
+	&glad_glCompressedTexSubImage2D,
+	&glad_glCompressedTexSubImage1D,
+	&glad_glGetCompressedTexImage,
+	/* GL_VERSION_1_4 */
+	&glad_glBlendFuncSeparate,
+	&glad_glMultiDrawArrays,
+	&glad_glMultiDrawElements,
+	&glad_glPointParameterf,
+	&glad_glPointParameterfv,
+	&glad_glPointParameteri,
+	&glad_glPointParameteriv,
+	&glad_glBlendColor,
+	&glad_glBlendEquation,
+	/* GL_VERSION_1_5 */
+	&glad_glGenQueries,
+	&glad_glDeleteQueries,
+	&glad_glIsQuery,
+	&glad_glBeginQuery,
+	&glad_glEndQuery,
+	&glad_glGetQueryiv,
+	&glad_glGetQueryObjectiv,
+	&glad_glGetQueryObjectuiv,
+	&glad_glBindBuffer,
+	&glad_glDeleteBuffers,
+	&glad_glGenBuffers,
+	&glad_glIsBuffer,
+	&glad_glBufferData,
+	&glad_glBufferSubData,
+	&glad_glGetBufferSubData,
+	&glad_glMapBuffer,
+	&glad_glUnmapBuffer,
+	&glad_glGetBufferParameteriv,
+	&glad_glGetBufferPointerv,
+	/* GL_VERSION_2_0 */
+	&glad_glBlendEquationSeparate,
+	&glad_glDrawBuffers,
+	&glad_glStencilOpSeparate,
+	&glad_glStencilFuncSeparate,
+	&glad_glStencilMaskSeparate,
+	&glad_glAttachShader,
+	&glad_glBindAttribLocation,
+	&glad_glCompileShader,
+	&glad_glCreateProgram,
+	&glad_glCreateShader,
+	&glad_glDeleteProgram,
+	&glad_glDeleteShader,
+	&glad_glDetachShader,
+	&glad_glDisableVertexAttribArray,
+	&glad_glEnableVertexAttribArray,
+	&glad_glGetActiveAttrib,
+	&glad_glGetActiveUniform,
+	&glad_glGetAttachedShaders,
+	&glad_glGetAttribLocation,
+	&glad_glGetProgramiv,
+	&glad_glGetProgramInfoLog,
+	&glad_glGetShaderiv,
+	&glad_glGetShaderInfoLog,
+	&glad_glGetShaderSource,
+	&glad_glGetUniformLocation,
+	&glad_glGetUniformfv,
+	&glad_glGetUniformiv,
+	&glad_glGetVertexAttribdv,
+	&glad_glGetVertexAttribfv,
+	&glad_glGetVertexAttribiv,
+	&glad_glGetVertexAttribPointerv,
+	&glad_glIsProgram,
+	&glad_glIsShader,
+	&glad_glLinkProgram,
+	&glad_glShaderSource,
+	&glad_glUseProgram,
+	&glad_glUniform1f,
+	&glad_glUniform2f,
+	&glad_glUniform3f,
+	&glad_glUniform4f,
+	&glad_glUniform1i,
+	&glad_glUniform2i,
+	&glad_glUniform3i,
+	&glad_glUniform4i,
+	&glad_glUniform1fv,
+	&glad_glUniform2fv,
+	&glad_glUniform3fv,
+	&glad_glUniform4fv,
+	&glad_glUniform1iv,
+	&glad_glUniform2iv,
+	&glad_glUniform3iv,
+	&glad_glUniform4iv,
+	&glad_glUniformMatrix2fv,
+	&glad_glUniformMatrix3fv,
+	&glad_glUniformMatrix4fv,
+	&glad_glValidateProgram,
+	&glad_glVertexAttrib1d,
+	&glad_glVertexAttrib1dv,
+	&glad_glVertexAttrib1f,
+	&glad_glVertexAttrib1fv,
+	&glad_glVertexAttrib1s,
+	&glad_glVertexAttrib1sv,
+	&glad_glVertexAttrib2d,
+	&glad_glVertexAttrib2dv,
+	&glad_glVertexAttrib2f,
+	&glad_glVertexAttrib2fv,
+	&glad_glVertexAttrib2s,
+	&glad_glVertexAttrib2sv,
+	&glad_glVertexAttrib3d,
+	&glad_glVertexAttrib3dv,
+	&glad_glVertexAttrib3f,
+	&glad_glVertexAttrib3fv,
+	&glad_glVertexAttrib3s,
+	&glad_glVertexAttrib3sv,
+	&glad_glVertexAttrib4Nbv,
+	&glad_glVertexAttrib4Niv,
+	&glad_glVertexAttrib4Nsv,
+	&glad_glVertexAttrib4Nub,
+	&glad_glVertexAttrib4Nubv,
+	&glad_glVertexAttrib4Nuiv,
+	&glad_glVertexAttrib4Nusv,
+	&glad_glVertexAttrib4bv,
+	&glad_glVertexAttrib4d,
+	&glad_glVertexAttrib4dv,
+	&glad_glVertexAttrib4f,
+	&glad_glVertexAttrib4fv,
+	&glad_glVertexAttrib4iv,
+	&glad_glVertexAttrib4s,
+	&glad_glVertexAttrib4sv,
+	&glad_glVertexAttrib4ubv,
+	&glad_glVertexAttrib4uiv,
+	&glad_glVertexAttrib4usv,
+	&glad_glVertexAttribPointer,
+	/* GL_VERSION_2_1 */
+	&glad_glUniformMatrix2x3fv,
+	&glad_glUniformMatrix3x2fv,
+	&glad_glUniformMatrix2x4fv,
+	&glad_glUniformMatrix4x2fv,
+	&glad_glUniformMatrix3x4fv,
+	&glad_glUniformMatrix4x3fv,
+	/* GL_VERSION_3_0 */
+	&glad_glColorMaski,
+	&glad_glGetBooleani_v,
+	&glad_glGetIntegeri_v,
+	&glad_glEnablei,
+	&glad_glDisablei,
+	&glad_glIsEnabledi,
+	&glad_glBeginTransformFeedback,
+	&glad_glEndTransformFeedback,
+	&glad_glBindBufferRange,
+	&glad_glBindBufferBase,
+	&glad_glTransformFeedbackVaryings,
+	&glad_glGetTransformFeedbackVarying,
+	&glad_glClampColor,
+	&glad_glBeginConditionalRender,
+	&glad_glEndConditionalRender,
+	&glad_glVertexAttribIPointer,
+	&glad_glGetVertexAttribIiv,
+	&glad_glGetVertexAttribIuiv,
+	&glad_glVertexAttribI1i,
+	&glad_glVertexAttribI2i,
+	&glad_glVertexAttribI3i,
+	&glad_glVertexAttribI4i,
+	&glad_glVertexAttribI1ui,
+	&glad_glVertexAttribI2ui,
+	&glad_glVertexAttribI3ui,
+	&glad_glVertexAttribI4ui,
+	&glad_glVertexAttribI1iv,
+	&glad_glVertexAttribI2iv,
+	&glad_glVertexAttribI3iv,
+	&glad_glVertexAttribI4iv,
+	&glad_glVertexAttribI1uiv,
+	&glad_glVertexAttribI2uiv,
+	&glad_glVertexAttribI3uiv,
+	&glad_glVertexAttribI4uiv,
+	&glad_glVertexAttribI4bv,
+	&glad_glVertexAttribI4sv,
+	&glad_glVertexAttribI4ubv,
+	&glad_glVertexAttribI4usv,
+	&glad_glGetUniformuiv,
+	&glad_glBindFragDataLocation,
+	&glad_glGetFragDataLocation,
+	&glad_glUniform1ui,
+	&glad_glUniform2ui,
+	&glad_glUniform3ui,
+	&glad_glUniform4ui,
+	&glad_glUniform1uiv,
+	&glad_glUniform2uiv,
+	&glad_glUniform3uiv,
+	&glad_glUniform4uiv,
+	&glad_glTexParameterIiv,
+	&glad_glTexParameterIuiv,
+	&glad_glGetTexParameterIiv,
+	&glad_glGetTexParameterIuiv,
+	&glad_glClearBufferiv,
+	&glad_glClearBufferuiv,
+	&glad_glClearBufferfv,
+	&glad_glClearBufferfi,
+	&glad_glGetStringi,
+	&glad_glIsRenderbuffer,
+	&glad_glBindRenderbuffer,
+	&glad_glDeleteRenderbuffers,
+	&glad_glGenRenderbuffers,
+	&glad_glRenderbufferStorage,
+	&glad_glGetRenderbufferParameteriv,
+	&glad_glIsFramebuffer,
+	&glad_glBindFramebuffer,
+	&glad_glDeleteFramebuffers,
+	&glad_glGenFramebuffers,
+	&glad_glCheckFramebufferStatus,
+	&glad_glFramebufferTexture1D,
+	&glad_glFramebufferTexture2D,
+	&glad_glFramebufferTexture3D,
+	&glad_glFramebufferRenderbuffer,
+	&glad_glGetFramebufferAttachmentParameteriv,
+	&glad_glGenerateMipmap,
+	&glad_glBlitFramebuffer,
+	&glad_glRenderbufferStorageMultisample,
+	&glad_glFramebufferTextureLayer,
+	&glad_glMapBufferRange,
+	&glad_glFlushMappedBufferRange,
+	&glad_glBindVertexArray,
+	&glad_glDeleteVertexArrays,
+	&glad_glGenVertexArrays,
+	&glad_glIsVertexArray,
+	/* GL_VERSION_3_1 */
+	&glad_glDrawArraysInstanced,
+	&glad_glDrawElementsInstanced,
+	&glad_glTexBuffer,
+	&glad_glPrimitiveRestartIndex,
+	&glad_glCopyBufferSubData,
+	&glad_glGetUniformIndices,
+	&glad_glGetActiveUniformsiv,
+	&glad_glGetActiveUniformName,
+	&glad_glGetUniformBlockIndex,
+	&glad_glGetActiveUniformBlockiv,
+	&glad_glGetActiveUniformBlockName,
+	&glad_glUniformBlockBinding,
+	&glad_glBindBufferRange,
+	&glad_glBindBufferBase,
+	&glad_glGetIntegeri_v,
+	/* GL_VERSION_3_2 */
+	&glad_glDrawElementsBaseVertex,
+	&glad_glDrawRangeElementsBaseVertex,
+	&glad_glDrawElementsInstancedBaseVertex,
+	&glad_glMultiDrawElementsBaseVertex,
+	&glad_glProvokingVertex,
+	&glad_glFenceSync,
+	&glad_glIsSync,
+	&glad_glDeleteSync,
+	&glad_glClientWaitSync,
+	&glad_glWaitSync,
+	&glad_glGetInteger64v,
+	&glad_glGetSynciv,
+	&glad_glGetInteger64i_v,
+	&glad_glGetBufferParameteri64v,
+	&glad_glFramebufferTexture,
+	&glad_glTexImage2DMultisample,
+	&glad_glTexImage3DMultisample,
+	&glad_glGetMultisamplefv,
+	&glad_glSampleMaski,
+	/* GL_VERSION_3_3 */
+	&glad_glBindFragDataLocationIndexed,
+	&glad_glGetFragDataIndex,
+	&glad_glGenSamplers,
+	&glad_glDeleteSamplers,
+	&glad_glIsSampler,
+	&glad_glBindSampler,
+	&glad_glSamplerParameteri,
+	&glad_glSamplerParameteriv,
+	&glad_glSamplerParameterf,
+	&glad_glSamplerParameterfv,
+	&glad_glSamplerParameterIiv,
+	&glad_glSamplerParameterIuiv,
+	&glad_glGetSamplerParameteriv,
+	&glad_glGetSamplerParameterIiv,
+	&glad_glGetSamplerParameterfv,
+	&glad_glGetSamplerParameterIuiv,
+	&glad_glQueryCounter,
+	&glad_glGetQueryObjecti64v,
+	&glad_glGetQueryObjectui64v,
+	&glad_glVertexAttribDivisor,
+	&glad_glVertexAttribP1ui,
+	&glad_glVertexAttribP1uiv,
+	&glad_glVertexAttribP2ui,
+	&glad_glVertexAttribP2uiv,
+	&glad_glVertexAttribP3ui,
+	&glad_glVertexAttribP3uiv,
+	&glad_glVertexAttribP4ui,
+	&glad_glVertexAttribP4uiv,
+	&glad_glVertexP2ui,
+	&glad_glVertexP2uiv,
+	&glad_glVertexP3ui,
+	&glad_glVertexP3uiv,
+	&glad_glVertexP4ui,
+	&glad_glVertexP4uiv,
+	&glad_glTexCoordP1ui,
+	&glad_glTexCoordP1uiv,
+	&glad_glTexCoordP2ui,
+	&glad_glTexCoordP2uiv,
+	&glad_glTexCoordP3ui,
+	&glad_glTexCoordP3uiv,
+	&glad_glTexCoordP4ui,
+	&glad_glTexCoordP4uiv,
+	&glad_glMultiTexCoordP1ui,
+	&glad_glMultiTexCoordP1uiv,
+	&glad_glMultiTexCoordP2ui,
+	&glad_glMultiTexCoordP2uiv,
+	&glad_glMultiTexCoordP3ui,
+	&glad_glMultiTexCoordP3uiv,
+	&glad_glMultiTexCoordP4ui,
+	&glad_glMultiTexCoordP4uiv,
+	&glad_glNormalP3ui,
+	&glad_glNormalP3uiv,
+	&glad_glColorP3ui,
+	&glad_glColorP3uiv,
+	&glad_glColorP4ui,
+	&glad_glColorP4uiv,
+	&glad_glSecondaryColorP3ui,
+	&glad_glSecondaryColorP3uiv,
+	/* GL_VERSION_4_0 */
+	&glad_glMinSampleShading,
+	&glad_glBlendEquationi,
+	&glad_glBlendEquationSeparatei,
+	&glad_glBlendFunci,
+	&glad_glBlendFuncSeparatei,
+	&glad_glDrawArraysIndirect,
+	&glad_glDrawElementsIndirect,
+	&glad_glUniform1d,
+	&glad_glUniform2d,
+	&glad_glUniform3d,
+	&glad_glUniform4d,
+	&glad_glUniform1dv,
+	&glad_glUniform2dv,
+	&glad_glUniform3dv,
+	&glad_glUniform4dv,
+	&glad_glUniformMatrix2dv,
+	&glad_glUniformMatrix3dv,
+	&glad_glUniformMatrix4dv,
+	&glad_glUniformMatrix2x3dv,
+	&glad_glUniformMatrix2x4dv,
+	&glad_glUniformMatrix3x2dv,
+	&glad_glUniformMatrix3x4dv,
+	&glad_glUniformMatrix4x2dv,
+	&glad_glUniformMatrix4x3dv,
+	&glad_glGetUniformdv,
+	&glad_glGetSubroutineUniformLocation,
+	&glad_glGetSubroutineIndex,
+	&glad_glGetActiveSubroutineUniformiv,
+	&glad_glGetActiveSubroutineUniformName,
+	&glad_glGetActiveSubroutineName,
+	&glad_glUniformSubroutinesuiv,
+	&glad_glGetUniformSubroutineuiv,
+	&glad_glGetProgramStageiv,
+	&glad_glPatchParameteri,
+	&glad_glPatchParameterfv,
+	&glad_glBindTransformFeedback,
+	&glad_glDeleteTransformFeedbacks,
+	&glad_glGenTransformFeedbacks,
+	&glad_glIsTransformFeedback,
+	&glad_glPauseTransformFeedback,
+	&glad_glResumeTransformFeedback,
+	&glad_glDrawTransformFeedback,
+	&glad_glDrawTransformFeedbackStream,
+	&glad_glBeginQueryIndexed,
+	&glad_glEndQueryIndexed,
+	&glad_glGetQueryIndexediv,
+	/* GL_VERSION_4_1 */
+	&glad_glReleaseShaderCompiler,
+	&glad_glShaderBinary,
+	&glad_glGetShaderPrecisionFormat,
+	&glad_glDepthRangef,
+	&glad_glClearDepthf,
+	&glad_glGetProgramBinary,
+	&glad_glProgramBinary,
+	&glad_glProgramParameteri,
+	&glad_glUseProgramStages,
+	&glad_glActiveShaderProgram,
+	&glad_glCreateShaderProgramv,
+	&glad_glBindProgramPipeline,
+	&glad_glDeleteProgramPipelines,
+	&glad_glGenProgramPipelines,
+	&glad_glIsProgramPipeline,
+	&glad_glGetProgramPipelineiv,
+	&glad_glProgramParameteri,
+	&glad_glProgramUniform1i,
+	&glad_glProgramUniform1iv,
+	&glad_glProgramUniform1f,
+	&glad_glProgramUniform1fv,
+	&glad_glProgramUniform1d,
+	&glad_glProgramUniform1dv,
+	&glad_glProgramUniform1ui,
+	&glad_glProgramUniform1uiv,
+	&glad_glProgramUniform2i,
+	&glad_glProgramUniform2iv,
+	&glad_glProgramUniform2f,
+	&glad_glProgramUniform2fv,
+	&glad_glProgramUniform2d,
+	&glad_glProgramUniform2dv,
+	&glad_glProgramUniform2ui,
+	&glad_glProgramUniform2uiv,
+	&glad_glProgramUniform3i,
+	&glad_glProgramUniform3iv,
+	&glad_glProgramUniform3f,
+	&glad_glProgramUniform3fv,
+	&glad_glProgramUniform3d,
+	&glad_glProgramUniform3dv,
+	&glad_glProgramUniform3ui,
+	&glad_glProgramUniform3uiv,
+	&glad_glProgramUniform4i,
+	&glad_glProgramUniform4iv,
+	&glad_glProgramUniform4f,
+	&glad_glProgramUniform4fv,
+	&glad_glProgramUniform4d,
+	&glad_glProgramUniform4dv,
+	&glad_glProgramUniform4ui,
+	&glad_glProgramUniform4uiv,
+	&glad_glProgramUniformMatrix2fv,
+	&glad_glProgramUniformMatrix3fv,
+	&glad_glProgramUniformMatrix4fv,
+	&glad_glProgramUniformMatrix2dv,
+	&glad_glProgramUniformMatrix3dv,
+	&glad_glProgramUniformMatrix4dv,
+	&glad_glProgramUniformMatrix2x3fv,
+	&glad_glProgramUniformMatrix3x2fv,
+	&glad_glProgramUniformMatrix2x4fv,
+	&glad_glProgramUniformMatrix4x2fv,
+	&glad_glProgramUniformMatrix3x4fv,
+	&glad_glProgramUniformMatrix4x3fv,
+	&glad_glProgramUniformMatrix2x3dv,
+	&glad_glProgramUniformMatrix3x2dv,
+	&glad_glProgramUniformMatrix2x4dv,
+	&glad_glProgramUniformMatrix4x2dv,
+	&glad_glProgramUniformMatrix3x4dv,
+	&glad_glProgramUniformMatrix4x3dv,
+	&glad_glValidateProgramPipeline,
+	&glad_glGetProgramPipelineInfoLog,
+	&glad_glVertexAttribL1d,
+	&glad_glVertexAttribL2d,
+	&glad_glVertexAttribL3d,
+	&glad_glVertexAttribL4d,
+	&glad_glVertexAttribL1dv,
+	&glad_glVertexAttribL2dv,
+	&glad_glVertexAttribL3dv,
+	&glad_glVertexAttribL4dv,
+	&glad_glVertexAttribLPointer,
+	&glad_glGetVertexAttribLdv,
+	&glad_glViewportArrayv,
+	&glad_glViewportIndexedf,
+	&glad_glViewportIndexedfv,
+	&glad_glScissorArrayv,
+	&glad_glScissorIndexed,
+	&glad_glScissorIndexedv,
+	&glad_glDepthRangeArrayv,
+	&glad_glDepthRangeIndexed,
+	&glad_glGetFloati_v,
+	&glad_glGetDoublei_v,
+	/* GL_VERSION_4_2 */
+	&glad_glDrawArraysInstancedBaseInstance,
+	&glad_glDrawElementsInstancedBaseInstance,
+	&glad_glDrawElementsInstancedBaseVertexBaseInstance,
+	&glad_glGetInternalformativ,
+	&glad_glGetActiveAtomicCounterBufferiv,
+	&glad_glBindImageTexture,
+	&glad_glMemoryBarrier,
+	&glad_glTexStorage1D,
+	&glad_glTexStorage2D,
+	&glad_glTexStorage3D,
+	&glad_glDrawTransformFeedbackInstanced,
+	&glad_glDrawTransformFeedbackStreamInstanced,
+	/* GL_VERSION_4_3 */
+	&glad_glClearBufferData,
+	&glad_glClearBufferSubData,
+	&glad_glDispatchCompute,
+	&glad_glDispatchComputeIndirect,
+	&glad_glCopyImageSubData,
+	&glad_glFramebufferParameteri,
+	&glad_glGetFramebufferParameteriv,
+	&glad_glGetInternalformati64v,
+	&glad_glInvalidateTexSubImage,
+	&glad_glInvalidateTexImage,
+	&glad_glInvalidateBufferSubData,
+	&glad_glInvalidateBufferData,
+	&glad_glInvalidateFramebuffer,
+	&glad_glInvalidateSubFramebuffer,
+	&glad_glMultiDrawArraysIndirect,
+	&glad_glMultiDrawElementsIndirect,
+	&glad_glGetProgramInterfaceiv,
+	&glad_glGetProgramResourceIndex,
+	&glad_glGetProgramResourceName,
+	&glad_glGetProgramResourceiv,
+	&glad_glGetProgramResourceLocation,
+	&glad_glGetProgramResourceLocationIndex,
+	&glad_glShaderStorageBlockBinding,
+	&glad_glTexBufferRange,
+	&glad_glTexStorage2DMultisample,
+	&glad_glTexStorage3DMultisample,
+	&glad_glTextureView,
+	&glad_glBindVertexBuffer,
+	&glad_glVertexAttribFormat,
+	&glad_glVertexAttribIFormat,
+	&glad_glVertexAttribLFormat,
+	&glad_glVertexAttribBinding,
+	&glad_glVertexBindingDivisor,
+	&glad_glDebugMessageControl,
+	&glad_glDebugMessageInsert,
+	&glad_glDebugMessageCallback,
+	&glad_glGetDebugMessageLog,
+	&glad_glPushDebugGroup,
+	&glad_glPopDebugGroup,
+	&glad_glObjectLabel,
+	&glad_glGetObjectLabel,
+	&glad_glObjectPtrLabel,
+	&glad_glGetObjectPtrLabel,
+	&glad_glGetPointerv,
+	/* GL_VERSION_4_4 */
+	&glad_glBufferStorage,
+	&glad_glClearTexImage,
+	&glad_glClearTexSubImage,
+	&glad_glBindBuffersBase,
+	&glad_glBindBuffersRange,
+	&glad_glBindTextures,
+	&glad_glBindSamplers,
+	&glad_glBindImageTextures,
+	&glad_glBindVertexBuffers,
+	/* GL_VERSION_4_5 */
+	&glad_glClipControl,
+	&glad_glCreateTransformFeedbacks,
+	&glad_glTransformFeedbackBufferBase,
+	&glad_glTransformFeedbackBufferRange,
+	&glad_glGetTransformFeedbackiv,
+	&glad_glGetTransformFeedbacki_v,
+	&glad_glGetTransformFeedbacki64_v,
+	&glad_glCreateBuffers,
+	&glad_glNamedBufferStorage,
+	&glad_glNamedBufferData,
+	&glad_glNamedBufferSubData,
+	&glad_glCopyNamedBufferSubData,
+	&glad_glClearNamedBufferData,
+	&glad_glClearNamedBufferSubData,
+	&glad_glMapNamedBuffer,
+	&glad_glMapNamedBufferRange,
+	&glad_glUnmapNamedBuffer,
+	&glad_glFlushMappedNamedBufferRange,
+	&glad_glGetNamedBufferParameteriv,
+	&glad_glGetNamedBufferParameteri64v,
+	&glad_glGetNamedBufferPointerv,
+	&glad_glGetNamedBufferSubData,
+	&glad_glCreateFramebuffers,
+	&glad_glNamedFramebufferRenderbuffer,
+	&glad_glNamedFramebufferParameteri,
+	&glad_glNamedFramebufferTexture,
+	&glad_glNamedFramebufferTextureLayer,
+	&glad_glNamedFramebufferDrawBuffer,
+	&glad_glNamedFramebufferDrawBuffers,
+	&glad_glNamedFramebufferReadBuffer,
+	&glad_glInvalidateNamedFramebufferData,
+	&glad_glInvalidateNamedFramebufferSubData,
+	&glad_glClearNamedFramebufferiv,
+	&glad_glClearNamedFramebufferuiv,
+	&glad_glClearNamedFramebufferfv,
+	&glad_glClearNamedFramebufferfi,
+	&glad_glBlitNamedFramebuffer,
+	&glad_glCheckNamedFramebufferStatus,
+	&glad_glGetNamedFramebufferParameteriv,
+	&glad_glGetNamedFramebufferAttachmentParameteriv,
+	&glad_glCreateRenderbuffers,
+	&glad_glNamedRenderbufferStorage,
+	&glad_glNamedRenderbufferStorageMultisample,
+	&glad_glGetNamedRenderbufferParameteriv,
+	&glad_glCreateTextures,
+	&glad_glTextureBuffer,
+	&glad_glTextureBufferRange,
+	&glad_glTextureStorage1D,
+	&glad_glTextureStorage2D,
+	&glad_glTextureStorage3D,
+	&glad_glTextureStorage2DMultisample,
+	&glad_glTextureStorage3DMultisample,
+	&glad_glTextureSubImage1D,
+	&glad_glTextureSubImage2D,
+	&glad_glTextureSubImage3D,
+	&glad_glCompressedTextureSubImage1D,
+	&glad_glCompressedTextureSubImage2D,
+	&glad_glCompressedTextureSubImage3D,
+	&glad_glCopyTextureSubImage1D,
+	&glad_glCopyTextureSubImage2D,
+	&glad_glCopyTextureSubImage3D,
+	&glad_glTextureParameterf,
+	&glad_glTextureParameterfv,
+	&glad_glTextureParameteri,
+	&glad_glTextureParameterIiv,
+	&glad_glTextureParameterIuiv,
+	&glad_glTextureParameteriv,
+	&glad_glGenerateTextureMipmap,
+	&glad_glBindTextureUnit,
+	&glad_glGetTextureImage,
+	&glad_glGetCompressedTextureImage,
+	&glad_glGetTextureLevelParameterfv,
+	&glad_glGetTextureLevelParameteriv,
+	&glad_glGetTextureParameterfv,
+	&glad_glGetTextureParameterIiv,
+	&glad_glGetTextureParameterIuiv,
+	&glad_glGetTextureParameteriv,
+	&glad_glCreateVertexArrays,
+	&glad_glDisableVertexArrayAttrib,
+	&glad_glEnableVertexArrayAttrib,
+	&glad_glVertexArrayElementBuffer,
+	&glad_glVertexArrayVertexBuffer,
+	&glad_glVertexArrayVertexBuffers,
+	&glad_glVertexArrayAttribBinding,
+	&glad_glVertexArrayAttribFormat,
+	&glad_glVertexArrayAttribIFormat,
+	&glad_glVertexArrayAttribLFormat,
+	&glad_glVertexArrayBindingDivisor,
+	&glad_glGetVertexArrayiv,
+	&glad_glGetVertexArrayIndexediv,
+	&glad_glGetVertexArrayIndexed64iv,
+	&glad_glCreateSamplers,
+	&glad_glCreateProgramPipelines,
+	&glad_glCreateQueries,
+	&glad_glGetQueryBufferObjecti64v,
+	&glad_glGetQueryBufferObjectiv,
+	&glad_glGetQueryBufferObjectui64v,
+	&glad_glGetQueryBufferObjectuiv,
+	&glad_glMemoryBarrierByRegion,
+	&glad_glGetTextureSubImage,
+	&glad_glGetCompressedTextureSubImage,
+	&glad_glGetGraphicsResetStatus,
+	&glad_glGetnCompressedTexImage,
+	&glad_glGetnTexImage,
+	&glad_glGetnUniformdv,
+	&glad_glGetnUniformfv,
+	&glad_glGetnUniformiv,
+	&glad_glGetnUniformuiv,
+	&glad_glReadnPixels,
+	&glad_glGetnMapdv,
+	&glad_glGetnMapfv,
+	&glad_glGetnMapiv,
+	&glad_glGetnPixelMapfv,
+	&glad_glGetnPixelMapuiv,
+	&glad_glGetnPixelMapusv,
+	&glad_glGetnPolygonStipple,
+	&glad_glGetnColorTable,
+	&glad_glGetnConvolutionFilter,
+	&glad_glGetnSeparableFilter,
+	&glad_glGetnHistogram,
+	&glad_glGetnMinmax,
+	&glad_glTextureBarrier,
+	/* GL_VERSION_4_6 */
+	&glad_glSpecializeShader,
+	&glad_glMultiDrawArraysIndirectCount,
+	&glad_glMultiDrawElementsIndirectCount,
+	&glad_glPolygonOffsetClamp,
+};
+
+static const struct { int *supported; unsigned short first; unsigned short count; } GLAD_GL_VERSION_RANGES[] = {
+	{ &GLAD_GL_VERSION_1_0, 0, 48 },
+	{ &GLAD_GL_VERSION_1_1, 48, 13 },
+	{ &GLAD_GL_VERSION_1_2, 61, 4 },
+	{ &GLAD_GL_VERSION_1_3, 65, 9 },
+	{ &GLAD_GL_VERSION_1_4, 74, 9 },
+	{ &GLAD_GL_VERSION_1_5, 83, 19 },
+	{ &GLAD_GL_VERSION_2_0, 102, 93 },
+	{ &GLAD_GL_VERSION_2_1, 195, 6 },
+	{ &GLAD_GL_VERSION_3_0, 201, 84 },
+	{ &GLAD_GL_VERSION_3_1, 285, 15 },
+	{ &GLAD_GL_VERSION_3_2, 300, 19 },
+	{ &GLAD_GL_VERSION_3_3, 319, 58 },
+	{ &GLAD_GL_VERSION_4_0, 377, 46 },
+	{ &GLAD_GL_VERSION_4_1, 423, 89 },
+	{ &GLAD_GL_VERSION_4_2, 512, 12 },
+	{ &GLAD_GL_VERSION_4_3, 524, 44 },
+	{ &GLAD_GL_VERSION_4_4, 568, 9 },
+	{ &GLAD_GL_VERSION_4_5, 577, 122 },
+	{ &GLAD_GL_VERSION_4_6, 699, 4 },
+};
+
+static void load_GL_versions(GLADloadproc load) {
+	size_t v, i;
+	for (v = 0; v < sizeof(GLAD_GL_VERSION_RANGES) / sizeof(GLAD_GL_VERSION_RANGES[0]); v++) {
+		if (!*GLAD_GL_VERSION_RANGES[v].supported) continue;
+		for (i = GLAD_GL_VERSION_RANGES[v].first; i < (size_t)GLAD_GL_VERSION_RANGES[v].first + GLAD_GL_VERSION_RANGES[v].count; i++) {
+			/* each entry has its own PFN type, so copy the pointer rather than store through a cast */
+			void *proc = load(GLAD_GL_NAMES + GLAD_GL_NAME_OFFSETS[i]);
+			memcpy(GLAD_GL_POINTERS[i], &proc, sizeof(proc));
+		}
+	}
 }
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
@@ -1807,25 +2627,7 @@ int gladLoadGLLoader(GLADloadproc load) {
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
-	load_GL_VERSION_1_0(load);
-	load_GL_VERSION_1_1(load);
-	load_GL_VERSION_1_2(load);
-	load_GL_VERSION_1_3(load);
-	load_GL_VERSION_1_4(load);
-	load_GL_VERSION_1_5(load);
-	load_GL_VERSION_2_0(load);
-	load_GL_VERSION_2_1(load);
-	load_GL_VERSION_3_0(load);
-	load_GL_VERSION_3_1(load);
-	load_GL_VERSION_3_2(load);
-	load_GL_VERSION_3_3(load);
-	load_GL_VERSION_4_0(load);
-	load_GL_VERSION_4_1(load);
-	load_GL_VERSION_4_2(load);
-	load_GL_VERSION_4_3(load);
-	load_GL_VERSION_4_4(load);
-	load_GL_VERSION_4_5(load);
-	load_GL_VERSION_4_6(load);
+	load_GL_versions(load);
 
 	if (!find_extensionsGL()) return 0;
 	return GLVersion.major != 0 || GLVersion.minor != 0;
@@ -0,0 +1,358 @@
+#include "hud.h"
+#include "shader.h"
+
+#include <cstddef>
+#include <cstdio>
+
+namespace
+{
+  // 5x7 bitmap font covering ASCII 32 (' ') to 95 ('_'); lowercase letters are drawn as uppercase.
+  // each glyph is 7 rows from top to bottom, with bit 4 of each row being the leftmost pixel
+  const int GLYPH_WIDTH = 5;
+  const int GLYPH_HEIGHT = 7;
+  const int FIRST_GLYPH = 32;
+  const int GLYPH_COUNT = 64;
+  const unsigned char FONT[GLYPH_COUNT][GLYPH_HEIGHT] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+    {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}, // '!'
+    {0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00}, // '"'
+    {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A}, // '#'
+    {0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04}, // '$'
+    {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}, // '%'
+    {0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D}, // '&'
+    {0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00}, // '\''
+    {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}, // '('
+    {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}, // ')'
+    {0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00}, // '*'
+    {0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00}, // '+'
+    {0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x08}, // ','
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}, // '-'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, // '.'
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, // '/'
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, // '0'
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, // '1'
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, // '2'
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, // '3'
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, // '4'
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, // '5'
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, // '6'
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, // '7'
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // '8'
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, // '9'
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, // ':'
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08}, // ';'
+    {0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02}, // '<'
+    {0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00}, // '='
+    {0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08}, // '>'
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, // '?'
+    {0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E}, // '@'
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'A'
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}, // 'B'
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}, // 'C'
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}, // 'D'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}, // 'E'
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}, // 'F'
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}, // 'G'
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // 'H'
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 'I'
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}, // 'J'
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, // 'K'
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}, // 'L'
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}, // 'M'
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, // 'N'
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'O'
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}, // 'P'
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}, // 'Q'
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}, // 'R'
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}, // 'S'
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // 'T'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // 'U'
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}, // 'V'
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}, // 'W'
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}, // 'X'
+    {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}, // 'Y'
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}, // 'Z'
+    {0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E}, // '['
+    {0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00}, // '\\'
+    {0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E}, // ']'
+    {0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00}, // '^'
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}, // '_'
+  };
+
+  // atlas layout: one padded cell per glyph, 16 cells per row, plus a solid cell after the last glyph
+  // that graph and background quads sample so they can share the text shader and draw call
+  const int CELL_WIDTH = GLYPH_WIDTH + 1;
+  const int CELL_HEIGHT = GLYPH_HEIGHT + 1;
+  const int ATLAS_COLUMNS = 16;
+  const int ATLAS_ROWS = GLYPH_COUNT / ATLAS_COLUMNS + 1;
+  const int ATLAS_WIDTH = ATLAS_COLUMNS * CELL_WIDTH;
+  const int ATLAS_HEIGHT = ATLAS_ROWS * CELL_HEIGHT;
+  const int SOLID_CELL = GLYPH_COUNT;
+
+  // on-screen layout, in framebuffer pixels
+  const float GLYPH_SCALE = 2.0f;
+  const float MARGIN = 10.0f;
+  const float PADDING = 6.0f;
+  const float LINE_HEIGHT = (GLYPH_HEIGHT + 2) * GLYPH_SCALE;
+  const float BAR_WIDTH = 2.0f;
+  const float GRAPH_HEIGHT = 60.0f;
+  const float GRAPH_MAX_MS = 1000.0f / 30.0f;
+  const float TARGET_MS = 1000.0f / 60.0f;
+
+  // colors are packed as 0xRRGGBBAA
+  const unsigned int PANEL_COLOR = 0x000000A0;
+  const unsigned int TEXT_COLOR = 0xFFFFFFFF;
+  const unsigned int TARGET_LINE_COLOR = 0xFFFFFF60;
+  const unsigned int FAST_COLOR = 0x40E040FF;
+  const unsigned int SLOW_COLOR = 0xE0E040FF;
+  const unsigned int VERY_SLOW_COLOR = 0xE04040FF;
+
+  const char *vertexShaderSource = R"(
+#version 330 core
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;
+
+uniform vec2 screenSize;
+
+out vec2 TexCoord;
+out vec4 Color;
+
+void main()
+{
+  // positions are in pixels with the origin at the top left of the screen
+  vec2 ndc = aPos / screenSize * 2.0 - 1.0;
+  gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+  TexCoord = aTexCoord;
+  Color = aColor;
+}
+)";
+
+  const char *fragmentShaderSource = R"(
+#version 330 core
+in vec2 TexCoord;
+in vec4 Color;
+
+uniform sampler2D atlas;
+
+out vec4 FragColor;
+
+void main()
+{
+  FragColor = vec4(Color.rgb, Color.a * texture(atlas, TexCoord).r);
+}
+)";
+}
+
+std::vector<unsigned char> Hud::rasterizeAtlas()
+{
+  std::vector<unsigned char> pixels(ATLAS_WIDTH * ATLAS_HEIGHT, 0);
+  for (int glyph = 0; glyph < GLYPH_COUNT; glyph++)
+  {
+    int cellX = (glyph % ATLAS_COLUMNS) * CELL_WIDTH;
+    int cellY = (glyph / ATLAS_COLUMNS) * CELL_HEIGHT;
+    for (int row = 0; row < GLYPH_HEIGHT; row++)
+    {
+      for (int column = 0; column < GLYPH_WIDTH; column++)
+      {
+        if (FONT[glyph][row] & (1 << (GLYPH_WIDTH - 1 - column)))
+        {
+          pixels[(cellY + row) * ATLAS_WIDTH + cellX + column] = 255;
+        }
+      }
+    }
+  }
+  int solidX = (SOLID_CELL % ATLAS_COLUMNS) * CELL_WIDTH;
+  int solidY = (SOLID_CELL / ATLAS_COLUMNS) * CELL_HEIGHT;
+  for (int row = 0; row < CELL_HEIGHT; row++)
+  {
+    for (int column = 0; column < CELL_WIDTH; column++)
+    {
+      pixels[(solidY + row) * ATLAS_WIDTH + solidX + column] = 255;
+    }
+  }
+  return pixels;
+}
+
+bool Hud::init(const std::string &description, const std::vector<unsigned char> &atlasPixels)
+{
+  contextDescription = description;
+
+  program = createShaderProgram(vertexShaderSource, fragmentShaderSource, "HUD");
+  if (program == 0)
+  {
+    return false;
+  }
+
+  glUseProgram(program);
+  glUniform1i(glGetUniformLocation(program, "atlas"), 0);
+  screenSizeLocation = glGetUniformLocation(program, "screenSize");
+
+  // upload the glyph atlas
+  glGenTextures(1, &atlas);
+  glBindTexture(GL_TEXTURE_2D, atlas);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, ATLAS_WIDTH, ATLAS_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, atlasPixels.data());
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  // vertex buffer, refilled every frame
+  glGenVertexArrays(1, &vao);
+  glGenBuffers(1, &vbo);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, x));
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, u));
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void *)offsetof(Vertex, r));
+  glEnableVertexAttribArray(2);
+  glBindVertexArray(0);
+
+  return true;
+}
+
+void Hud::destroy()
+{
+  glDeleteVertexArrays(1, &vao);
+  glDeleteBuffers(1, &vbo);
+  glDeleteTextures(1, &atlas);
+  glDeleteProgram(program);
+  vao = vbo = atlas = program = 0;
+}
+
+void Hud::recordFrame(float frameTime)
+{
+  frameTimes[nextSample] = frameTime * 1000.0f;
+  nextSample = (nextSample + 1) % GRAPH_SAMPLES;
+  if (sampleCount < GRAPH_SAMPLES)
+  {
+    sampleCount++;
+  }
+}
+
+void Hud::draw(int framebufferWidth, int framebufferHeight)
+{
+  if (sampleCount == 0 || framebufferWidth == 0 || framebufferHeight == 0)
+  {
+    return;
+  }
+
+  float lastMs = frameTimes[(nextSample + GRAPH_SAMPLES - 1) % GRAPH_SAMPLES];
+  float totalMs = 0.0f;
+  float maxMs = 0.0f;
+  for (int i = 0; i < sampleCount; i++)
+  {
+    totalMs += frameTimes[i];
+    if (frameTimes[i] > maxMs)
+    {
+      maxMs = frameTimes[i];
+    }
+  }
+
+  char lines[2][64];
+  std::snprintf(lines[0], sizeof(lines[0]), "FRAME %6.2f MS %6.0f FPS", lastMs, lastMs > 0.0f ? 1000.0f / lastMs : 0.0f);
+  std::snprintf(lines[1], sizeof(lines[1]), "AVG   %6.2f MS  MAX %6.2f", totalMs / sampleCount, maxMs);
+
+  float graphWidth = GRAPH_SAMPLES * BAR_WIDTH;
+  float textX = MARGIN + PADDING;
+  float textY = MARGIN + PADDING;
+  float graphTop = textY + 3 * LINE_HEIGHT + PADDING;
+  float graphBottom = graphTop + GRAPH_HEIGHT;
+
+  vertices.clear();
+  // size the panel to fit the widest of the text lines and the graph
+  float panelWidth = graphWidth;
+  for (const std::string &line : {std::string(lines[0]), std::string(lines[1]), contextDescription})
+  {
+    float lineWidth = line.size() * CELL_WIDTH * GLYPH_SCALE;
+    if (lineWidth > panelWidth)
+    {
+      panelWidth = lineWidth;
+    }
+  }
+  addRect(MARGIN, MARGIN, textX + panelWidth + PADDING, graphBottom + PADDING, PANEL_COLOR);
+  addText(textX, textY, lines[0], TEXT_COLOR);
+  addText(textX, textY + LINE_HEIGHT, lines[1], TEXT_COLOR);
+  addText(textX, textY + 2 * LINE_HEIGHT, contextDescription, TEXT_COLOR);
+
+  // frame time graph, oldest sample on the left
+  for (int i = 0; i < sampleCount; i++)
+  {
+    int sample = (nextSample + GRAPH_SAMPLES - sampleCount + i) % GRAPH_SAMPLES;
+    float ms = frameTimes[sample];
+    float height = (ms < GRAPH_MAX_MS ? ms / GRAPH_MAX_MS : 1.0f) * GRAPH_HEIGHT;
+    unsigned int color = ms <= TARGET_MS * 1.05f ? FAST_COLOR : (ms <= GRAPH_MAX_MS ? SLOW_COLOR : VERY_SLOW_COLOR);
+    float x = textX + (GRAPH_SAMPLES - sampleCount + i) * BAR_WIDTH;
+    addRect(x, graphBottom - height, x + BAR_WIDTH, graphBottom, color);
+  }
+  float targetY = graphBottom - TARGET_MS / GRAPH_MAX_MS * GRAPH_HEIGHT;
+  addRect(textX, targetY, textX + graphWidth, targetY + 1.0f, TARGET_LINE_COLOR);
+
+  glBindBuffer(GL_ARRAY_BUFFER, vbo);
+  glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STREAM_DRAW);
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  glUseProgram(program);
+  glUniform2f(screenSizeLocation, (float)framebufferWidth, (float)framebufferHeight);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, atlas);
+  glBindVertexArray(vao);
+  glDrawArrays(GL_TRIANGLES, 0, (GLsizei)vertices.size());
+  glBindVertexArray(0);
+  glDisable(GL_BLEND);
+}
+
+void Hud::addQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, unsigned int color)
+{
+  unsigned char r = (color >> 24) & 0xFF;
+  unsigned char g = (color >> 16) & 0xFF;
+  unsigned char b = (color >> 8) & 0xFF;
+  unsigned char a = color & 0xFF;
+
+  Vertex topLeft = {x0, y0, u0, v0, r, g, b, a};
+  Vertex topRight = {x1, y0, u1, v0, r, g, b, a};
+  Vertex bottomLeft = {x0, y1, u0, v1, r, g, b, a};
+  Vertex bottomRight = {x1, y1, u1, v1, r, g, b, a};
+
+  vertices.push_back(topLeft);
+  vertices.push_back(bottomLeft);
+  vertices.push_back(topRight);
+  vertices.push_back(topRight);
+  vertices.push_back(bottomLeft);
+  vertices.push_back(bottomRight);
+}
+
+void Hud::addRect(float x0, float y0, float x1, float y1, unsigned int color)
+{
+  // sample the middle of the solid cell so nearest filtering never picks up a neighbouring glyph
+  float u = ((SOLID_CELL % ATLAS_COLUMNS) * CELL_WIDTH + CELL_WIDTH * 0.5f) / ATLAS_WIDTH;
+  float v = ((SOLID_CELL / ATLAS_COLUMNS) * CELL_HEIGHT + CELL_HEIGHT * 0.5f) / ATLAS_HEIGHT;
+  addQuad(x0, y0, x1, y1, u, v, u, v, color);
+}
+
+void Hud::addText(float x, float y, const std::string &text, unsigned int color)
+{
+  for (char c : text)
+  {
+    if (c >= 'a' && c <= 'z')
+    {
+      c = c - 'a' + 'A';
+    }
+    // spaces and characters outside the font only advance the cursor
+    int glyph = c - FIRST_GLYPH;
+    if (glyph > 0 && glyph < GLYPH_COUNT)
+    {
+      float u0 = (float)((glyph % ATLAS_COLUMNS) * CELL_WIDTH) / ATLAS_WIDTH;
+      float v0 = (float)((glyph / ATLAS_COLUMNS) * CELL_HEIGHT) / ATLAS_HEIGHT;
+      float u1 = u0 + (float)GLYPH_WIDTH / ATLAS_WIDTH;
+      float v1 = v0 + (float)GLYPH_HEIGHT / ATLAS_HEIGHT;
+      addQuad(x, y, x + GLYPH_WIDTH * GLYPH_SCALE, y + GLYPH_HEIGHT * GLYPH_SCALE, u0, v0, u1, v1, color);
+    }
+    x += CELL_WIDTH * GLYPH_SCALE;
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+
+// on-screen performance overlay: a frame time graph and stats text. the glyph atlas is rasterized once by
+// rasterizeAtlas() (no GL context needed) and uploaded in init(), and all text and graph quads are
+// appended to one vertex buffer and drawn in a single call.
+class Hud
+{
+public:
+  // CPU half of initialisation: rasterize the glyph atlas. needs no GL context, so it can run before the
+  // window exists if startup ever has heavier work to overlap with context creation
+  static std::vector<unsigned char> rasterizeAtlas();
+
+  // description is shown as an extra line under the frame time stats, e.g. the GL context version
+  bool init(const std::string &description, const std::vector<unsigned char> &atlasPixels);
+  void destroy();
+
+  // record the duration of the last frame in seconds. call once per frame, even while the HUD is hidden,
+  // so the graph is already populated when it is toggled on
+  void recordFrame(float frameTime);
+
+  // draw the overlay on top of whatever is in the framebuffer
+  void draw(int framebufferWidth, int framebufferHeight);
+
+private:
+  struct Vertex
+  {
+    float x, y;
+    float u, v;
+    unsigned char r, g, b, a;
+  };
+
+  static const int GRAPH_SAMPLES = 120;
+
+  void addQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, unsigned int color);
+  void addRect(float x0, float y0, float x1, float y1, unsigned int color);
+  void addText(float x, float y, const std::string &text, unsigned int color);
+
+  GLuint program = 0;
+  GLuint vao = 0;
+  GLuint vbo = 0;
+  GLuint atlas = 0;
+  GLint screenSizeLocation = -1;
+
+  std::vector<Vertex> vertices;
+  std::string contextDescription;
+
+  float frameTimes[GRAPH_SAMPLES] = {};
+  int nextSample = 0;
+  int sampleCount = 0;
+};
+
+#endif
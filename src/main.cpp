@@ -1,7 +1,12 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include "debug_draw.h"
+#include "gl_caps.h"
+#include "hud.h"
+
 #include <iostream>
+#include <string>
 
 void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 void processInput(GLFWwindow *window);
@@ -10,20 +15,35 @@ void processInput(GLFWwindow *window);
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
+// core context versions to try, newest first. 4.3+ unlocks compute and multi-draw indirect, 4.4 buffer
+// storage and 4.5 direct state access; 3.3 is the baseline every renderer must support
+const int CONTEXT_VERSIONS[][2] = {{4, 6}, {4, 5}, {4, 3}, {3, 3}};
+
+// performance HUD, toggled with F1
+bool showHud = false;
+
 int main()
 {
   // glfw: initialize and configure
   glfwInit();
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
 #ifdef __APPLE__
   glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
-  // glfw window creation
-  GLFWwindow *window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Graphics Project", NULL, NULL);
+  // glfw window creation, falling back through the context versions until the driver accepts one
+  GLFWwindow *window = NULL;
+  for (const auto &version : CONTEXT_VERSIONS)
+  {
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, version[0]);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, version[1]);
+    window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Graphics Project", NULL, NULL);
+    if (window != NULL)
+    {
+      break;
+    }
+  }
   if (window == NULL)
   {
     std::cout << "Failed to create GLFW window" << std::endl;
@@ -40,9 +60,35 @@ int main()
     return -1;
   }
 
+  // record the version the driver actually gave us; renderers pick their fast paths from this
+  GLCapabilities glCaps = queryGLCapabilities();
+  std::string glDescription = describeGLCapabilities(glCaps);
+  std::cout << "Using " << glDescription << std::endl;
+
+  Hud hud;
+  if (!hud.init(glDescription, Hud::rasterizeAtlas()))
+  {
+    std::cout << "Failed to initialise HUD" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+
+  if (!debugDraw::init())
+  {
+    std::cout << "Failed to initialise debug drawing" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+
   // render loop
+  double lastFrame = glfwGetTime();
   while (!glfwWindowShouldClose(window))
   {
+    // per-frame time
+    double currentFrame = glfwGetTime();
+    hud.recordFrame((float)(currentFrame - lastFrame));
+    lastFrame = currentFrame;
+
     // check for and process input
     processInput(window);
 
@@ -51,11 +97,23 @@ int main()
     glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
+    // there is no camera yet, so debug primitives are given directly in clip space
+    debugDraw::flush(glm::mat4(1.0f));
+
+    if (showHud)
+    {
+      int framebufferWidth, framebufferHeight;
+      glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+      hud.draw(framebufferWidth, framebufferHeight);
+    }
+
     // check and call events and swap the buffers
     glfwSwapBuffers(window);
     glfwPollEvents();
   }
 
+  debugDraw::destroy();
+  hud.destroy();
   glfwTerminate();
   return 0;
 }
@@ -67,6 +125,15 @@ void processInput(GLFWwindow *window)
   {
     glfwSetWindowShouldClose(window, true);
   }
+
+  // toggle the HUD once per key press rather than every frame the key is held
+  static bool hudKeyWasDown = false;
+  bool hudKeyDown = glfwGetKey(window, GLFW_KEY_F1) == GLFW_PRESS;
+  if (hudKeyDown && !hudKeyWasDown)
+  {
+    showHud = !showHud;
+  }
+  hudKeyWasDown = hudKeyDown;
 }
 
 // glfw: whenever the window size changed (by OS or user resize) this callback function executes
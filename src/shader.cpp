@@ -0,0 +1,58 @@
+#include "shader.h"
+
+#include <iostream>
+
+namespace
+{
+  GLuint compileShader(GLenum type, const char *source, const char *name)
+  {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    int success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success)
+    {
+      char infoLog[512];
+      glGetShaderInfoLog(shader, sizeof(infoLog), NULL, infoLog);
+      std::cout << "Failed to compile " << name << " shader\n"
+                << infoLog << std::endl;
+      glDeleteShader(shader);
+      return 0;
+    }
+    return shader;
+  }
+}
+
+GLuint createShaderProgram(const char *vertexSource, const char *fragmentSource, const char *name)
+{
+  GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource, name);
+  GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource, name);
+  if (vertexShader == 0 || fragmentShader == 0)
+  {
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    return 0;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertexShader);
+  glAttachShader(program, fragmentShader);
+  glLinkProgram(program);
+  glDeleteShader(vertexShader);
+  glDeleteShader(fragmentShader);
+
+  int success;
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success)
+  {
+    char infoLog[512];
+    glGetProgramInfoLog(program, sizeof(infoLog), NULL, infoLog);
+    std::cout << "Failed to link " << name << " shader program\n"
+              << infoLog << std::endl;
+    glDeleteProgram(program);
+    return 0;
+  }
+  return program;
+}
@@ -0,0 +1,10 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+
+// compile and link a vertex/fragment shader pair. on failure the info log is printed, prefixed with name,
+// and 0 is returned
+GLuint createShaderProgram(const char *vertexSource, const char *fragmentSource, const char *name);
+
+#endif
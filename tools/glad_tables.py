@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Replace the per-version load functions in a glad 0.1 generated glad.c with constant tables.
+
+glad generates one load_GL_VERSION_x_y function per core version, each a long list of
+    glad_glXxx = (PFNGLXXXPROC)load("glXxx");
+assignments. This script rewrites them into a single blob of NUL-terminated names, a parallel
+array of offsets into it, a parallel array of glad_gl* pointer addresses and a per-version range
+table, all walked by one load_GL_versions() loop. Offsets and ranges are computed here, so they
+can never drift from the names.
+
+Usage, after regenerating glad:
+    python3 tools/glad_tables.py src/glad.c
+"""
+
+import re
+import sys
+
+LOAD_FUNCTION = re.compile(
+    r'static void load_GL_VERSION_(\d)_(\d)\(GLADloadproc load\) \{\n'
+    r'\tif\(!GLAD_GL_VERSION_\1_\2\) return;\n(.*?)\n\}\n', re.S)
+LOAD_LINE = re.compile(r'^\tglad_(\w+) = \(PFN\w+\)load\("(\w+)"\);$')
+
+HEADER_ANCHOR = 'https://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D4.6\n'
+HEADER_NOTE = '''
+    Local changes:
+        The generated load_GL_VERSION_1_0 .. load_GL_VERSION_4_6 functions were replaced by the
+        GLAD_GL_NAMES / GLAD_GL_NAME_OFFSETS / GLAD_GL_POINTERS tables and load_GL_versions(),
+        produced by tools/glad_tables.py. Rerun it on a freshly generated glad.c after
+        regenerating glad; do not edit the tables by hand.
+'''
+
+
+def parse_versions(source):
+    versions = []
+    span = None
+    for match in LOAD_FUNCTION.finditer(source):
+        names = []
+        for line in match.group(3).split('\n'):
+            load = LOAD_LINE.match(line)
+            if not load or load.group(1) != load.group(2):
+                sys.exit('unexpected load line: %r' % line)
+            names.append(load.group(2))
+        versions.append(('%s_%s' % (match.group(1), match.group(2)), names))
+        span = (span[0] if span else match.start(), match.end())
+    if not versions:
+        sys.exit('no load_GL_VERSION_* functions found; is this an unmodified glad.c?')
+    if source[span[0]:span[1]].count('static void load_GL_VERSION_') != len(versions):
+        sys.exit('load_GL_VERSION_* functions are not contiguous')
+    return versions, span
+
+
+def emit_tables(versions):
+    names = [name for _, version_names in versions for name in version_names]
+    offsets = []
+    offset = 0
+    for name in names:
+        offsets.append(offset)
+        offset += len(name) + 1
+    offset_type = 'unsigned short' if offset <= 0xFFFF else 'unsigned int'
+    count_type = 'unsigned short' if len(names) <= 0xFFFF else 'unsigned int'
+
+    out = []
+    out.append('/* Core function names and pointers for every GL version, in the order load_GL_versions() resolves them.')
+    out.append(' * GLAD_GL_NAMES is a single blob of NUL-terminated names, GLAD_GL_NAME_OFFSETS indexes into it and')
+    out.append(' * GLAD_GL_POINTERS holds the address of the matching glad_gl* pointer. Each GL version owns a')
+    out.append(' * contiguous range of entries in GLAD_GL_VERSION_RANGES. */')
+
+    out.append('static const char GLAD_GL_NAMES[] =')
+    for version, version_names in versions:
+        out.append('\t/* GL_VERSION_%s */' % version)
+        for name in version_names:
+            out.append('\t"%s\\0"' % name)
+    out[-1] += ';'
+    out.append('')
+
+    out.append('static const %s GLAD_GL_NAME_OFFSETS[] = {' % offset_type)
+    index = 0
+    for version, version_names in versions:
+        out.append('\t/* GL_VERSION_%s */' % version)
+        version_offsets = offsets[index:index + len(version_names)]
+        index += len(version_names)
+        for row in range(0, len(version_offsets), 12):
+            out.append('\t' + ', '.join(str(value) for value in version_offsets[row:row + 12]) + ',')
+    out.append('};')
+    out.append('')
+
+    out.append('static void *const GLAD_GL_POINTERS[] = {')
+    for version, version_names in versions:
+        out.append('\t/* GL_VERSION_%s */' % version)
+        for name in version_names:
+            out.append('\t&glad_%s,' % name)
+    out.append('};')
+    out.append('')
+
+    out.append('static const struct { int *supported; %s first; %s count; } GLAD_GL_VERSION_RANGES[] = {'
+               % (count_type, count_type))
+    first = 0
+    for version, version_names in versions:
+        out.append('\t{ &GLAD_GL_VERSION_%s, %d, %d },' % (version, first, len(version_names)))
+        first += len(version_names)
+    out.append('};')
+    out.append('')
+
+    out.append('''static void load_GL_versions(GLADloadproc load) {
+\tsize_t v, i;
+\tfor (v = 0; v < sizeof(GLAD_GL_VERSION_RANGES) / sizeof(GLAD_GL_VERSION_RANGES[0]); v++) {
+\t\tif (!*GLAD_GL_VERSION_RANGES[v].supported) continue;
+\t\tfor (i = GLAD_GL_VERSION_RANGES[v].first; i < (size_t)GLAD_GL_VERSION_RANGES[v].first + GLAD_GL_VERSION_RANGES[v].count; i++) {
+\t\t\t/* each entry has its own PFN type, so copy the pointer rather than store through a cast */
+\t\t\tvoid *proc = load(GLAD_GL_NAMES + GLAD_GL_NAME_OFFSETS[i]);
+\t\t\tmemcpy(GLAD_GL_POINTERS[i], &proc, sizeof(proc));
+\t\t}
+\t}
+}
+''')
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: glad_tables.py path/to/glad.c')
+    path = sys.argv[1]
+    with open(path) as f:
+        source = f.read()
+
+    versions, (start, end) = parse_versions(source)
+    source = source[:start] + emit_tables(versions) + source[end:]
+
+    calls = ''.join('\tload_GL_VERSION_%s(load);\n' % version for version, _ in versions)
+    if calls not in source:
+        sys.exit('could not find the load_GL_VERSION_* calls in gladLoadGLLoader')
+    source = source.replace(calls, '\tload_GL_versions(load);\n')
+
+    if HEADER_ANCHOR not in source:
+        sys.exit('could not find the glad header comment')
+    source = source.replace(HEADER_ANCHOR, HEADER_ANCHOR + HEADER_NOTE, 1)
+
+    with open(path, 'w') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()